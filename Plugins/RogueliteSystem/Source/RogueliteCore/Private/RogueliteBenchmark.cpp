@@ -0,0 +1,295 @@
+#include "RogueliteBenchmark.h"
+#include "RogueliteSubsystem.h"
+#include "RogueliteActionData.h"
+#include "RogueliteMallocCounter.h"
+#include "RogueliteSettings.h"
+#include "RogueliteStats.h"
+#include "GameplayTagsManager.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace RogueliteBenchmark
+{
+	// 쿼리/선택 반복 횟수
+	static constexpr int32 QueryIterations = 1000;
+
+	// 저장/복원 반복 횟수
+	static constexpr int32 SaveIterations = 100;
+
+	// 획득 최대 횟수
+	static constexpr int32 MaxAcquireIterations = 1000;
+
+	// 소수 태그에 몰리는 분포 (실제 카탈로그처럼 일부 태그가 대부분의 액션에 붙음)
+	static int32 PickSkewed(FRandomStream& Stream, int32 Num)
+	{
+		return FMath::Min(FMath::FloorToInt(Num * FMath::Square(Stream.FRand())), Num - 1);
+	}
+
+	template <typename FuncType>
+	static void Measure(TArray<FResult>& Results, int32 CatalogSize, const TCHAR* Operation, int32 Iterations, FuncType&& Func)
+	{
+		FResult Result;
+		Result.CatalogSize = CatalogSize;
+		Result.Operation = Operation;
+		Result.Iterations = Iterations;
+		{
+			FRogueliteScopedMallocCounter MallocCounter;
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+
+			for (int32 i = 0; i < Iterations; ++i)
+			{
+				Func(i);
+			}
+
+			Result.TotalMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+			Result.Allocations = MallocCounter.GetNumAllocations();
+			Result.AllocatedKB = MallocCounter.GetAllocatedBytes() / 1024;
+		}
+
+		UE_LOG(LogRoguelite, Display, TEXT("[Benchmark] %7d %-24s %6d iters  %10.3fms  %8.3fus/op  %8lld allocs"),
+			CatalogSize, Operation, Iterations, Result.TotalMs, Result.GetAverageUs(), Result.Allocations);
+		Results.Add(MoveTemp(Result));
+	}
+
+	// 합성 액션 생성 (풀 태그 1개 + 분류 태그 0~3개, 가중치/스택/수치 무작위)
+	static void BuildCatalog(int32 Num, FRandomStream& Stream, const TArray<FGameplayTag>& PoolTags, const TArray<FGameplayTag>& OtherTags, TArray<URogueliteActionData*>& OutActions)
+	{
+		OutActions.Reset(Num);
+		for (int32 i = 0; i < Num; ++i)
+		{
+			URogueliteActionData* Action = NewObject<URogueliteActionData>(GetTransientPackage(), NAME_None, RF_Transient);
+			Action->ActionTags.AddTag(PoolTags[Stream.RandHelper(PoolTags.Num())]);
+
+			const int32 NumExtraTags = OtherTags.Num() > 0 ? Stream.RandRange(0, 3) : 0;
+			for (int32 t = 0; t < NumExtraTags; ++t)
+			{
+				Action->ActionTags.AddTag(OtherTags[PickSkewed(Stream, OtherTags.Num())]);
+			}
+
+			Action->BaseWeight = Stream.FRandRange(0.1f, 10.f);
+			Action->MaxStacks = Stream.RandRange(1, 5);
+			Action->bAutoGrantTags = Stream.FRand() < 0.2f;
+
+			if (OtherTags.Num() > 0)
+			{
+				FRogueliteValueEntry& Entry = Action->Values.AddDefaulted_GetRef();
+				Entry.Key = OtherTags[PickSkewed(Stream, OtherTags.Num())];
+				Entry.Value = Stream.FRandRange(1.f, 10.f);
+			}
+
+			OutActions.Add(Action);
+		}
+	}
+
+	void RunCatalog(int32 CatalogSize, const TArray<FGameplayTag>& PoolTags, const TArray<FGameplayTag>& OtherTags, TArray<FResult>& Results)
+	{
+		// 벤치마크 중에는 리플레이 기록/디버그 로그 비활성화
+		URogueliteSettings* Settings = GetMutableDefault<URogueliteSettings>();
+		TGuardValue<bool> ReplayGuard(Settings->bEnableReplayLog, false);
+		TGuardValue<bool> LoggingGuard(Settings->bEnableDebugLogging, false);
+
+		FRandomStream Stream(CatalogSize);
+
+		TArray<URogueliteActionData*> Actions;
+		BuildCatalog(CatalogSize, Stream, PoolTags, OtherTags, Actions);
+
+		// 실제 런 상태를 건드리지 않도록 전용 게임 인스턴스 (서브시스템 Initialize/Deinitialize 정상 경로)
+		UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+		GameInstance->AddToRoot();
+		GameInstance->InitializeStandalone(MakeUniqueObjectName(GetTransientPackage(), UWorld::StaticClass(), TEXT("RogueliteBenchmarkWorld")));
+		URogueliteSubsystem* Subsystem = GameInstance->GetSubsystem<URogueliteSubsystem>();
+
+		Measure(Results, CatalogSize, TEXT("RegisterAction"), Actions.Num(), [&](int32 i)
+		{
+			Subsystem->RegisterAction(Actions[i]);
+		});
+
+		Subsystem->StartRun(CatalogSize);
+
+		auto RunQuery = [&](int32 i)
+		{
+			FRogueliteQuery Query;
+			Query.PoolTags.AddTag(PoolTags[i % PoolTags.Num()]);
+			Query.Count = 3;
+			Query.Mode = ERogueliteQueryMode::NewOrAcquired;
+			Subsystem->ExecuteQuery(Query);
+		};
+
+		// 풀 태그마다 한 번씩 돌려 임시 버퍼 용량 확보
+		for (int32 i = 0; i < PoolTags.Num(); ++i)
+		{
+			RunQuery(i);
+		}
+
+		const int32 GrowthBefore = Subsystem->GetQueryScratchGrowthCount();
+		Measure(Results, CatalogSize, TEXT("ExecuteQuery"), QueryIterations, RunQuery);
+		Results.Last().ScratchGrowth = Subsystem->GetQueryScratchGrowthCount() - GrowthBefore;
+
+		// 호출자 버퍼 경로 (결과 배열 할당 없음)
+		FRogueliteQuery IntoQuery;
+		IntoQuery.Count = 3;
+		IntoQuery.Mode = ERogueliteQueryMode::NewOrAcquired;
+		URogueliteActionData* IntoResults[3];
+		const int32 IntoGrowthBefore = Subsystem->GetQueryScratchGrowthCount();
+		Measure(Results, CatalogSize, TEXT("ExecuteQueryInto"), QueryIterations, [&](int32 i)
+		{
+			IntoQuery.PoolTags.Reset();
+			IntoQuery.PoolTags.AddTag(PoolTags[i % PoolTags.Num()]);
+			Subsystem->ExecuteQueryInto(IntoQuery, MakeArrayView(IntoResults));
+		});
+		Results.Last().ScratchGrowth = Subsystem->GetQueryScratchGrowthCount() - IntoGrowthBefore;
+
+		// WeightedSelect와 같은 추첨 엔진
+		TArray<float> Weights;
+		Weights.Reserve(Actions.Num());
+		for (URogueliteActionData* Action : Actions)
+		{
+			Weights.Add(Action->BaseWeight);
+		}
+
+		FRogueliteWeightedPool Pool;
+		Measure(Results, CatalogSize, TEXT("WeightedPoolBuild"), 1, [&](int32 i)
+		{
+			Pool.BuildFromWeights(TConstArrayView<float>(Weights));
+		});
+
+		// 결과/추첨 버퍼는 측정 전에 확보 (측정 구간 할당은 추첨 자체의 비용만)
+		TArray<int32> Picked;
+		FRogueliteWeightedDrawScratch DrawScratch;
+		Pool.DrawUnique(Stream, 3, Picked, &DrawScratch);
+		Measure(Results, CatalogSize, TEXT("DrawUnique"), QueryIterations, [&](int32 i)
+		{
+			Pool.DrawUnique(Stream, 3, Picked, &DrawScratch);
+		});
+
+		Measure(Results, CatalogSize, TEXT("DrawMany"), QueryIterations, [&](int32 i)
+		{
+			Pool.DrawMany(Stream, 3, Picked);
+		});
+
+		Measure(Results, CatalogSize, TEXT("TryAcquireAction"), FMath::Min(CatalogSize, MaxAcquireIterations), [&](int32 i)
+		{
+			FString FailReason;
+			Subsystem->TryAcquireAction(Actions[Stream.RandHelper(Actions.Num())], FailReason);
+		});
+
+		FRogueliteRunSaveData SaveData;
+		Measure(Results, CatalogSize, TEXT("CreateRunSaveData"), SaveIterations, [&](int32 i)
+		{
+			SaveData = Subsystem->CreateRunSaveData();
+		});
+
+		Measure(Results, CatalogSize, TEXT("RestoreRunFromSaveData"), SaveIterations, [&](int32 i)
+		{
+			Subsystem->RestoreRunFromSaveData(SaveData);
+		});
+
+		Subsystem->EndRun(false);
+
+		UWorld* World = GameInstance->GetWorld();
+		GameInstance->Shutdown();
+		if (World)
+		{
+			World->DestroyWorld(false);
+		}
+		GameInstance->RemoveFromRoot();
+		GameInstance->MarkAsGarbage();
+
+		for (URogueliteActionData* Action : Actions)
+		{
+			Action->MarkAsGarbage();
+		}
+	}
+
+	const FResult* FindResult(const TArray<FResult>& Results, int32 CatalogSize, const TCHAR* Operation)
+	{
+		return Results.FindByPredicate([CatalogSize, Operation](const FResult& Result)
+		{
+			return Result.CatalogSize == CatalogSize && Result.Operation == Operation;
+		});
+	}
+
+	static void Run(const TArray<FString>& Args)
+	{
+		TArray<int32> CatalogSizes;
+		for (const FString& Arg : Args)
+		{
+			const int32 Size = FCString::Atoi(*Arg);
+			if (Size > 0)
+			{
+				CatalogSizes.Add(Size);
+			}
+		}
+		if (CatalogSizes.Num() == 0)
+		{
+			CatalogSizes = { 100, 1000, 10000, 100000 };
+		}
+
+		// 등록된 태그에서 풀 태그와 분류/수치 태그 분리
+		FGameplayTagContainer AllTags;
+		UGameplayTagsManager::Get().RequestAllGameplayTags(AllTags, true);
+
+		const FGameplayTag PoolRoot = FGameplayTag::RequestGameplayTag(TEXT("Pool"), false);
+		TArray<FGameplayTag> PoolTags;
+		TArray<FGameplayTag> OtherTags;
+		for (const FGameplayTag& Tag : AllTags)
+		{
+			if (PoolRoot.IsValid() && Tag.MatchesTag(PoolRoot) && Tag != PoolRoot)
+			{
+				PoolTags.Add(Tag);
+			}
+			else
+			{
+				OtherTags.Add(Tag);
+			}
+		}
+		if (PoolTags.Num() == 0)
+		{
+			if (OtherTags.Num() == 0)
+			{
+				UE_LOG(LogRoguelite, Error, TEXT("[Benchmark] No gameplay tags registered"));
+				return;
+			}
+			PoolTags.Add(OtherTags[0]);
+		}
+
+		TArray<FResult> Results;
+		for (int32 CatalogSize : CatalogSizes)
+		{
+			RunCatalog(CatalogSize, PoolTags, OtherTags, Results);
+		}
+
+		FString Csv = TEXT("CatalogSize,Operation,Iterations,TotalMs,AvgUs,OpsPerSec,Allocations,AllocatedKB,ScratchGrowth\n");
+		for (const FResult& Result : Results)
+		{
+			const double OpsPerSec = Result.TotalMs > 0.0 ? Result.Iterations * 1000.0 / Result.TotalMs : 0.0;
+			Csv += FString::Printf(TEXT("%d,%s,%d,%.4f,%.4f,%.1f,%lld,%lld,%d\n"),
+				Result.CatalogSize, *Result.Operation, Result.Iterations, Result.TotalMs, Result.GetAverageUs(), OpsPerSec, Result.Allocations, Result.AllocatedKB, Result.ScratchGrowth);
+		}
+
+		const FString FilePath = FPaths::ProfilingDir() / TEXT("Roguelite") / FString::Printf(TEXT("Benchmark-%s.csv"), *FDateTime::Now().ToString());
+		if (FFileHelper::SaveStringToFile(Csv, *FilePath))
+		{
+			UE_LOG(LogRoguelite, Display, TEXT("[Benchmark] Results written to %s"), *FilePath);
+		}
+		else
+		{
+			UE_LOG(LogRoguelite, Error, TEXT("[Benchmark] Failed to write %s"), *FilePath);
+		}
+	}
+}
+
+static FAutoConsoleCommand CmdRogueliteBenchmark(
+	TEXT("Roguelite.Benchmark"),
+	TEXT("Run query/acquire/save benchmarks on synthetic catalogs and write CSV to Saved/Profiling/Roguelite. Args: catalog sizes (default 100 1000 10000 100000)."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&RogueliteBenchmark::Run));
+
+#endif
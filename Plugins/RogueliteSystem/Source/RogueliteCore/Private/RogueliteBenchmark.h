@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+#if !UE_BUILD_SHIPPING
+
+/**
+ * 합성 카탈로그 기반 쿼리/획득/저장 벤치마크.
+ * 헤드리스 실행: -nullrhi -ExecCmds="Roguelite.Benchmark 100 1000 10000 100000"
+ * 회귀 판정은 Roguelite.Benchmark.Regression 자동화 테스트.
+ */
+namespace RogueliteBenchmark
+{
+	// 측정 결과 (CSV 한 줄)
+	struct FResult
+	{
+		int32 CatalogSize = 0;
+		FString Operation;
+		int32 Iterations = 0;
+		double TotalMs = 0.0;
+		// 게임 스레드 할당 횟수/요청 크기 (FRogueliteScopedMallocCounter)
+		int64 Allocations = 0;
+		int64 AllocatedKB = 0;
+		// 쿼리 임시 버퍼 증가 횟수 (쿼리 측정만, 워밍업 이후 0이어야 함)
+		int32 ScratchGrowth = 0;
+
+		double GetAverageUs() const { return Iterations > 0 ? TotalMs * 1000.0 / Iterations : 0.0; }
+	};
+
+	// CatalogSize개 합성 액션으로 전용 게임 인스턴스에서 전 항목 측정
+	void RunCatalog(int32 CatalogSize, const TArray<FGameplayTag>& PoolTags, const TArray<FGameplayTag>& OtherTags, TArray<FResult>& Results);
+
+	// Operation 이름으로 결과 찾기
+	const FResult* FindResult(const TArray<FResult>& Results, int32 CatalogSize, const TCHAR* Operation);
+}
+
+#endif
@@ -1,4 +1,9 @@
 ﻿#include "RogueliteCore.h"
+#include "RogueliteStats.h"
+
+DEFINE_LOG_CATEGORY(LogRoguelite);
+
+UE_TRACE_CHANNEL_DEFINE(RogueliteChannel);
 
 #define LOCTEXT_NAMESPACE "FRogueliteCoreModule"
 
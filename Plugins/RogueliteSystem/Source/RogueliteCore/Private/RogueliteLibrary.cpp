@@ -45,13 +45,31 @@ TArray<URogueliteActionData*> URogueliteLibrary::GetActionsByTag(const UObject*
 	return TArray<URogueliteActionData*>();
 }
 
+int32 URogueliteLibrary::GetActionCount(const UObject* WorldContextObject)
+{
+	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		return Subsystem->GetActionCount();
+	}
+	return 0;
+}
+
+URogueliteActionData* URogueliteLibrary::GetActionAt(const UObject* WorldContextObject, int32 Index)
+{
+	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		return Subsystem->GetActionAt(Index);
+	}
+	return nullptr;
+}
+
 /*~ Run ~*/
 
-void URogueliteLibrary::StartRun(const UObject* WorldContextObject)
+void URogueliteLibrary::StartRun(const UObject* WorldContextObject, int32 Seed)
 {
 	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
 	{
-		Subsystem->StartRun();
+		Subsystem->StartRun(Seed);
 	}
 }
 
@@ -81,6 +99,33 @@ FRogueliteRunState URogueliteLibrary::GetRunState(const UObject* WorldContextObj
 	return FRogueliteRunState();
 }
 
+int32 URogueliteLibrary::GetRunStateVersion(const UObject* WorldContextObject)
+{
+	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		return Subsystem->GetRunStateVersion();
+	}
+	return 0;
+}
+
+int32 URogueliteLibrary::GetChangeVersion(const UObject* WorldContextObject, ERogueliteChangeCategory Category)
+{
+	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		return Subsystem->GetChangeVersion(Category);
+	}
+	return 0;
+}
+
+int32 URogueliteLibrary::GetRunSeed(const UObject* WorldContextObject)
+{
+	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		return Subsystem->GetRunSeed();
+	}
+	return 0;
+}
+
 /*~ Query ~*/
 
 TArray<URogueliteActionData*> URogueliteLibrary::QuerySimple(const UObject* WorldContextObject, URoguelitePoolPreset* Preset, int32 Count)
@@ -101,6 +146,20 @@ TArray<URogueliteActionData*> URogueliteLibrary::QueryByTag(const UObject* World
 	return TArray<URogueliteActionData*>();
 }
 
+void URogueliteLibrary::BuildWeightedPool(FRogueliteWeightedPool& Pool)
+{
+	Pool.Build();
+}
+
+TArray<int32> URogueliteLibrary::DrawFromWeightedPool(const UObject* WorldContextObject, const FRogueliteWeightedPool& Pool, FGameplayTag StreamKey, int32 Count, bool bUnique)
+{
+	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		return Subsystem->DrawFromWeightedPool(Pool, StreamKey, Count, bUnique);
+	}
+	return TArray<int32>();
+}
+
 TArray<URogueliteActionData*> URogueliteLibrary::ExecuteQuery(const UObject* WorldContextObject, const FRogueliteQuery& QueryStruct)
 {
 	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
@@ -110,6 +169,29 @@ TArray<URogueliteActionData*> URogueliteLibrary::ExecuteQuery(const UObject* Wor
 	return TArray<URogueliteActionData*>();
 }
 
+TArray<URogueliteActionData*> URogueliteLibrary::ExecuteQueryWithReport(const UObject* WorldContextObject, const FRogueliteQuery& QueryStruct, FRogueliteQueryReport& OutReport)
+{
+	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		return Subsystem->ExecuteQueryWithReport(QueryStruct, OutReport);
+	}
+	return TArray<URogueliteActionData*>();
+}
+
+FRogueliteQueryReport URogueliteLibrary::GetLastQueryReport(const UObject* WorldContextObject)
+{
+	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		return Subsystem->GetLastQueryReport();
+	}
+	return FRogueliteQueryReport();
+}
+
+FString URogueliteLibrary::QueryReportToString(const FRogueliteQueryReport& Report)
+{
+	return Report.ToString();
+}
+
 /*~ Action ~*/
 
 bool URogueliteLibrary::AcquireAction(const UObject* WorldContextObject, URogueliteActionData* Action, int32 StacksToAdd)
@@ -176,6 +258,42 @@ TArray<URogueliteActionData*> URogueliteLibrary::GetAcquiredWithTag(const UObjec
 	return TArray<URogueliteActionData*>();
 }
 
+int32 URogueliteLibrary::GetAcquiredCountWithTag(const UObject* WorldContextObject, FGameplayTag Tag)
+{
+	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		return Subsystem->GetAcquiredCountWithTag(Tag);
+	}
+	return 0;
+}
+
+int32 URogueliteLibrary::GetAcquiredStacksWithTag(const UObject* WorldContextObject, FGameplayTag Tag)
+{
+	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		return Subsystem->GetAcquiredStacksWithTag(Tag);
+	}
+	return 0;
+}
+
+int32 URogueliteLibrary::GetAcquiredCount(const UObject* WorldContextObject)
+{
+	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		return Subsystem->GetAcquiredCount();
+	}
+	return 0;
+}
+
+URogueliteActionData* URogueliteLibrary::GetAcquiredAt(const UObject* WorldContextObject, int32 Index)
+{
+	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		return Subsystem->GetAcquiredAt(Index);
+	}
+	return nullptr;
+}
+
 /*~ Tags ~*/
 
 void URogueliteLibrary::AddTagToSystem(const UObject* WorldContextObject, FGameplayTag Tag)
@@ -194,6 +312,15 @@ void URogueliteLibrary::RemoveTagFromSystem(const UObject* WorldContextObject, F
 	}
 }
 
+int32 URogueliteLibrary::GetTagRefCount(const UObject* WorldContextObject, FGameplayTag Tag)
+{
+	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		return Subsystem->GetTagRefCount(Tag);
+	}
+	return 0;
+}
+
 bool URogueliteLibrary::HasTagInSystem(const UObject* WorldContextObject, FGameplayTag Tag)
 {
 	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
@@ -249,6 +376,24 @@ TMap<FGameplayTag, float> URogueliteLibrary::GetAllRunStateValues(const UObject*
 	return TMap<FGameplayTag, float>();
 }
 
+int32 URogueliteLibrary::GetRunStateValueCount(const UObject* WorldContextObject)
+{
+	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		return Subsystem->GetRunStateValueCount();
+	}
+	return 0;
+}
+
+bool URogueliteLibrary::GetRunStateValueAt(const UObject* WorldContextObject, int32 Index, FGameplayTag& OutKey, float& OutValue)
+{
+	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		return Subsystem->GetRunStateValueAt(Index, OutKey, OutValue);
+	}
+	return false;
+}
+
 /*~ Slots ~*/
 
 bool URogueliteLibrary::EquipActionToSlot(const UObject* WorldContextObject, URogueliteActionData* Action, FGameplayTag SlotTag)
@@ -277,6 +422,15 @@ TArray<URogueliteActionData*> URogueliteLibrary::GetSlotContents(const UObject*
 	return TArray<URogueliteActionData*>();
 }
 
+URogueliteActionData* URogueliteLibrary::GetSlotActionAt(const UObject* WorldContextObject, FGameplayTag SlotTag, int32 Index)
+{
+	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		return Subsystem->GetSlotActionAt(SlotTag, Index);
+	}
+	return nullptr;
+}
+
 int32 URogueliteLibrary::GetSlotCount(const UObject* WorldContextObject, FGameplayTag SlotTag)
 {
 	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
@@ -313,3 +467,15 @@ void URogueliteLibrary::RestoreRunFromSaveData(const UObject* WorldContextObject
 		Subsystem->RestoreRunFromSaveData(SaveData);
 	}
 }
+
+/*~ Replay ~*/
+
+bool URogueliteLibrary::ReplayRunFromLog(const UObject* WorldContextObject, const FString& FilePath, FString& OutFailReason)
+{
+	if (URogueliteSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		return Subsystem->ReplayRunFromLog(FilePath, OutFailReason);
+	}
+	OutFailReason = TEXT("Subsystem not found");
+	return false;
+}
\ No newline at end of file
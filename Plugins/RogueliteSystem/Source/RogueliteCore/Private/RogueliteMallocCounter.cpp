@@ -0,0 +1,147 @@
+#include "RogueliteMallocCounter.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTLS.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	// 이전 GMalloc으로 그대로 전달하면서 소유 스레드의 할당만 세는 프록시
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		FMalloc* Inner = nullptr;
+		uint32 OwnerThreadId = 0;
+		int64 NumAllocations = 0;
+		int64 AllocatedBytes = 0;
+
+		void Record(SIZE_T Size)
+		{
+			if (FPlatformTLS::GetCurrentThreadId() == OwnerThreadId)
+			{
+				++NumAllocations;
+				AllocatedBytes += Size;
+			}
+		}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Record(Count);
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Record(Count);
+			return Inner->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				Record(Count);
+			}
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				Record(Count);
+			}
+			return Inner->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override
+		{
+			Inner->Free(Original);
+		}
+
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+		{
+			return Inner->GetAllocationSize(Original, SizeOut);
+		}
+
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+		{
+			return Inner->QuantizeSize(Count, Alignment);
+		}
+
+		virtual void Trim(bool bTrimThreadCaches) override
+		{
+			Inner->Trim(bTrimThreadCaches);
+		}
+
+		virtual void SetupTLSCachesOnCurrentThread() override
+		{
+			Inner->SetupTLSCachesOnCurrentThread();
+		}
+
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+		{
+			Inner->ClearAndDisableTLSCachesOnCurrentThread();
+		}
+
+		virtual bool IsInternallyThreadSafe() const override
+		{
+			return Inner->IsInternallyThreadSafe();
+		}
+
+		virtual bool ValidateHeap() override
+		{
+			return Inner->ValidateHeap();
+		}
+
+		virtual const TCHAR* GetDescriptiveName() override
+		{
+			return TEXT("RogueliteCountingMalloc");
+		}
+	};
+
+	// 교체 해제 직후에도 다른 스레드가 프록시를 거칠 수 있으므로 해제하지 않음
+	FCountingMalloc& GetCountingMalloc()
+	{
+		static FCountingMalloc* Instance = new FCountingMalloc();
+		return *Instance;
+	}
+}
+
+FRogueliteScopedMallocCounter::FRogueliteScopedMallocCounter()
+{
+	FCountingMalloc& Proxy = GetCountingMalloc();
+	check(GMalloc != &Proxy);
+
+	Proxy.Inner = GMalloc;
+	Proxy.OwnerThreadId = FPlatformTLS::GetCurrentThreadId();
+	Proxy.NumAllocations = 0;
+	Proxy.AllocatedBytes = 0;
+
+	PreviousMalloc = GMalloc;
+	FPlatformMisc::MemoryBarrier();
+	GMalloc = &Proxy;
+}
+
+FRogueliteScopedMallocCounter::~FRogueliteScopedMallocCounter()
+{
+	GMalloc = PreviousMalloc;
+}
+
+int64 FRogueliteScopedMallocCounter::GetNumAllocations() const
+{
+	return GetCountingMalloc().NumAllocations;
+}
+
+int64 FRogueliteScopedMallocCounter::GetAllocatedBytes() const
+{
+	return GetCountingMalloc().AllocatedBytes;
+}
+
+void FRogueliteScopedMallocCounter::Reset()
+{
+	GetCountingMalloc().NumAllocations = 0;
+	GetCountingMalloc().AllocatedBytes = 0;
+}
+
+#endif
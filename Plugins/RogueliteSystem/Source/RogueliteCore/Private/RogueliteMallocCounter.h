@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+/**
+ * 스코프 동안 현재 스레드의 FMemory 할당 횟수/요청 바이트 측정 (벤치마크/테스트 전용).
+ * GMalloc을 카운팅 프록시로 잠시 교체하고 소멸 시 되돌림. 다른 스레드 할당은 세지 않으며 중첩 불가.
+ */
+class FRogueliteScopedMallocCounter
+{
+public:
+	FRogueliteScopedMallocCounter();
+	~FRogueliteScopedMallocCounter();
+
+	FRogueliteScopedMallocCounter(const FRogueliteScopedMallocCounter&) = delete;
+	FRogueliteScopedMallocCounter& operator=(const FRogueliteScopedMallocCounter&) = delete;
+
+	// 할당 횟수 (Malloc + Realloc)
+	int64 GetNumAllocations() const;
+
+	// 요청 바이트
+	int64 GetAllocatedBytes() const;
+
+	// 카운트 초기화 (워밍업 이후 측정용)
+	void Reset();
+
+private:
+	FMalloc* PreviousMalloc = nullptr;
+};
+
+#endif
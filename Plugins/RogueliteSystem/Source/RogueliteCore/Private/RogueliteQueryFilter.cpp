@@ -1,5 +1,6 @@
 #include "RogueliteQueryFilter.h"
 #include "RogueliteActionData.h"
+#include "RogueliteQueryReport.h"
 
 /*~ URogueliteQueryFilter ~*/
 
@@ -8,6 +9,34 @@ bool URogueliteQueryFilter::PassesFilter_Implementation(URogueliteActionData* Ac
 	return true;
 }
 
+bool URogueliteQueryFilter::Evaluate(URogueliteActionData* Action, const FRogueliteRunState& RunState, FRogueliteQueryReport* Report) const
+{
+	if (!Report)
+	{
+		return EvaluateInternal(Action, RunState, nullptr);
+	}
+
+	const int32 NodeIndex = Report->BeginFilterNode(this);
+	const bool bPassed = EvaluateInternal(Action, RunState, Report);
+	Report->EndFilterNode(NodeIndex, bPassed);
+	return bPassed;
+}
+
+bool URogueliteQueryFilter::IsThreadSafe() const
+{
+	return false;
+}
+
+bool URogueliteQueryFilter::EvaluateInternal(URogueliteActionData* Action, const FRogueliteRunState& RunState, FRogueliteQueryReport* Report) const
+{
+	// 네이티브 클래스는 블루프린트 재정의가 없으므로 ProcessEvent 없이 직접 호출 (워커 스레드 평가 경로)
+	if (GetClass()->HasAnyClassFlags(CLASS_Native))
+	{
+		return PassesFilter_Implementation(Action, RunState);
+	}
+	return PassesFilter(Action, RunState);
+}
+
 /*~ URogueliteFilter_IsAcquired ~*/
 
 bool URogueliteFilter_IsAcquired::PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const
@@ -15,6 +44,11 @@ bool URogueliteFilter_IsAcquired::PassesFilter_Implementation(URogueliteActionDa
 	return RunState.HasAction(Action);
 }
 
+bool URogueliteFilter_IsAcquired::IsThreadSafe() const
+{
+	return GetClass() == StaticClass();
+}
+
 /*~ URogueliteFilter_NotAcquired ~*/
 
 bool URogueliteFilter_NotAcquired::PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const
@@ -22,6 +56,11 @@ bool URogueliteFilter_NotAcquired::PassesFilter_Implementation(URogueliteActionD
 	return !RunState.HasAction(Action);
 }
 
+bool URogueliteFilter_NotAcquired::IsThreadSafe() const
+{
+	return GetClass() == StaticClass();
+}
+
 /*~ URogueliteFilter_NotMaxStacked ~*/
 
 bool URogueliteFilter_NotMaxStacked::PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const
@@ -35,6 +74,11 @@ bool URogueliteFilter_NotMaxStacked::PassesFilter_Implementation(URogueliteActio
 	return !Action->IsMaxStacked(CurrentStacks);
 }
 
+bool URogueliteFilter_NotMaxStacked::IsThreadSafe() const
+{
+	return GetClass() == StaticClass();
+}
+
 /*~ URogueliteFilter_HasTags ~*/
 
 bool URogueliteFilter_HasTags::PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const
@@ -59,6 +103,11 @@ bool URogueliteFilter_HasTags::PassesFilter_Implementation(URogueliteActionData*
 	}
 }
 
+bool URogueliteFilter_HasTags::IsThreadSafe() const
+{
+	return GetClass() == StaticClass();
+}
+
 /*~ URogueliteFilter_ValueCompare ~*/
 
 bool URogueliteFilter_ValueCompare::PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const
@@ -97,13 +146,40 @@ bool URogueliteFilter_ValueCompare::PassesFilter_Implementation(URogueliteAction
 	return false;
 }
 
+bool URogueliteFilter_ValueCompare::IsThreadSafe() const
+{
+	return GetClass() == StaticClass();
+}
+
 /*~ URogueliteFilter_And ~*/
 
 bool URogueliteFilter_And::PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const
+{
+	return EvaluateInternal(Action, RunState, nullptr);
+}
+
+bool URogueliteFilter_And::IsThreadSafe() const
+{
+	if (GetClass() != StaticClass())
+	{
+		return false;
+	}
+
+	for (URogueliteQueryFilter* Filter : SubFilters)
+	{
+		if (IsValid(Filter) && !Filter->IsThreadSafe())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool URogueliteFilter_And::EvaluateInternal(URogueliteActionData* Action, const FRogueliteRunState& RunState, FRogueliteQueryReport* Report) const
 {
 	for (URogueliteQueryFilter* Filter : SubFilters)
 	{
-		if (IsValid(Filter) && !Filter->PassesFilter(Action, RunState))
+		if (IsValid(Filter) && !Filter->Evaluate(Action, RunState, Report))
 		{
 			return false;
 		}
@@ -114,6 +190,28 @@ bool URogueliteFilter_And::PassesFilter_Implementation(URogueliteActionData* Act
 /*~ URogueliteFilter_Or ~*/
 
 bool URogueliteFilter_Or::PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const
+{
+	return EvaluateInternal(Action, RunState, nullptr);
+}
+
+bool URogueliteFilter_Or::IsThreadSafe() const
+{
+	if (GetClass() != StaticClass())
+	{
+		return false;
+	}
+
+	for (URogueliteQueryFilter* Filter : SubFilters)
+	{
+		if (IsValid(Filter) && !Filter->IsThreadSafe())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool URogueliteFilter_Or::EvaluateInternal(URogueliteActionData* Action, const FRogueliteRunState& RunState, FRogueliteQueryReport* Report) const
 {
 	if (SubFilters.Num() == 0)
 	{
@@ -122,7 +220,7 @@ bool URogueliteFilter_Or::PassesFilter_Implementation(URogueliteActionData* Acti
 
 	for (URogueliteQueryFilter* Filter : SubFilters)
 	{
-		if (IsValid(Filter) && Filter->PassesFilter(Action, RunState))
+		if (IsValid(Filter) && Filter->Evaluate(Action, RunState, Report))
 		{
 			return true;
 		}
@@ -133,13 +231,27 @@ bool URogueliteFilter_Or::PassesFilter_Implementation(URogueliteActionData* Acti
 /*~ URogueliteFilter_Not ~*/
 
 bool URogueliteFilter_Not::PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const
+{
+	return EvaluateInternal(Action, RunState, nullptr);
+}
+
+bool URogueliteFilter_Not::IsThreadSafe() const
+{
+	if (GetClass() != StaticClass())
+	{
+		return false;
+	}
+	return !IsValid(SubFilter) || SubFilter->IsThreadSafe();
+}
+
+bool URogueliteFilter_Not::EvaluateInternal(URogueliteActionData* Action, const FRogueliteRunState& RunState, FRogueliteQueryReport* Report) const
 {
 	if (!IsValid(SubFilter))
 	{
 		return true;
 	}
 
-	return !SubFilter->PassesFilter(Action, RunState);
+	return !SubFilter->Evaluate(Action, RunState, Report);
 }
 
 /*~ URogueliteFilter_ExcludeNewWithTag ~*/
@@ -165,3 +277,8 @@ bool URogueliteFilter_ExcludeNewWithTag::PassesFilter_Implementation(URogueliteA
 
 	return true;
 }
+
+bool URogueliteFilter_ExcludeNewWithTag::IsThreadSafe() const
+{
+	return GetClass() == StaticClass();
+}
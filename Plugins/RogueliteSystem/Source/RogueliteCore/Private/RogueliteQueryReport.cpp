@@ -0,0 +1,85 @@
+#include "RogueliteQueryReport.h"
+
+void FRogueliteQueryReport::Reset()
+{
+	PoolName.Reset();
+	NumCandidates = 0;
+	NumPassed = 0;
+	NumSelected = 0;
+	CollectTimeMs = 0.f;
+	FilterTimeMs = 0.f;
+	SelectTimeMs = 0.f;
+
+	Stages.SetNum(static_cast<int32>(ERogueliteQueryStage::MAX));
+	for (int32 i = 0; i < Stages.Num(); ++i)
+	{
+		Stages[i] = FRogueliteQueryStageReport();
+		Stages[i].Stage = static_cast<ERogueliteQueryStage>(i);
+	}
+
+	FilterNodes.Reset();
+	FilterNodeIndices.Reset();
+	FilterDepth = 0;
+}
+
+void FRogueliteQueryReport::RecordStage(ERogueliteQueryStage Stage, bool bPassed, double TimeMs)
+{
+	FRogueliteQueryStageReport& StageReport = Stages[static_cast<int32>(Stage)];
+	++StageReport.Evaluated;
+	StageReport.Rejected += bPassed ? 0 : 1;
+	StageReport.TimeMs += TimeMs;
+}
+
+int32 FRogueliteQueryReport::BeginFilterNode(const UObject* Filter)
+{
+	int32 NodeIndex = INDEX_NONE;
+	if (const int32* Found = FilterNodeIndices.Find(Filter))
+	{
+		NodeIndex = *Found;
+	}
+	else
+	{
+		NodeIndex = FilterNodes.AddDefaulted();
+		FilterNodes[NodeIndex].FilterName = GetNameSafe(Filter);
+		FilterNodes[NodeIndex].Depth = FilterDepth;
+		FilterNodeIndices.Add(Filter, NodeIndex);
+	}
+
+	++FilterDepth;
+	return NodeIndex;
+}
+
+void FRogueliteQueryReport::EndFilterNode(int32 NodeIndex, bool bPassed)
+{
+	--FilterDepth;
+
+	FRogueliteFilterNodeReport& Node = FilterNodes[NodeIndex];
+	++Node.Evaluated;
+	Node.Passed += bPassed ? 1 : 0;
+}
+
+FString FRogueliteQueryReport::ToString() const
+{
+	FString Result = FString::Printf(TEXT("Query [%s]: %d candidates -> %d passed -> %d selected (collect %.3fms, filter %.3fms, select %.3fms)\n"),
+		*PoolName, NumCandidates, NumPassed, NumSelected, CollectTimeMs, FilterTimeMs, SelectTimeMs);
+
+	const UEnum* StageEnum = StaticEnum<ERogueliteQueryStage>();
+	for (const FRogueliteQueryStageReport& Stage : Stages)
+	{
+		if (Stage.Evaluated == 0)
+		{
+			continue;
+		}
+
+		Result += FString::Printf(TEXT("  %-14s evaluated %6d  rejected %6d  %.3fms\n"),
+			*StageEnum->GetNameStringByValue(static_cast<int64>(Stage.Stage)), Stage.Evaluated, Stage.Rejected, Stage.TimeMs);
+	}
+
+	for (const FRogueliteFilterNodeReport& Node : FilterNodes)
+	{
+		Result += FString::Printf(TEXT("  %s%s  %d/%d passed (%.0f%%)\n"),
+			*FString::ChrN(Node.Depth * 2, TEXT(' ')), *Node.FilterName, Node.Passed, Node.Evaluated, Node.GetPassRate() * 100.f);
+	}
+
+	return Result;
+}
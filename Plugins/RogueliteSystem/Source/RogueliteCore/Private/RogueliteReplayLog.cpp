@@ -0,0 +1,211 @@
+#include "RogueliteReplayLog.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace RogueliteReplay
+{
+	// 파일 식별자 ('RGLR')
+	static constexpr uint32 Magic = 0x524C4752;
+
+	// 포맷 버전
+	static constexpr int32 Version = 2;
+}
+
+/*~ FRogueliteReplayEvent ~*/
+
+FArchive& operator<<(FArchive& Ar, FRogueliteReplayEvent& Event)
+{
+	uint8 TypeValue = static_cast<uint8>(Event.Type);
+	Ar << TypeValue;
+	Event.Type = static_cast<ERogueliteReplayEventType>(TypeValue);
+
+	// 태그와 경로는 이름 테이블에 의존하지 않도록 문자열로 기록
+	FString TagName = Event.Tag.ToString();
+	Ar << TagName;
+	if (Ar.IsLoading())
+	{
+		Event.Tag = FGameplayTag::RequestGameplayTag(FName(*TagName), false);
+	}
+
+	Ar << Event.StreamStateBefore;
+	Ar << Event.StreamStateAfter;
+
+	int32 NumPaths = Event.ActionPaths.Num();
+	Ar << NumPaths;
+	if (Ar.IsLoading())
+	{
+		Event.ActionPaths.SetNum(NumPaths);
+	}
+	for (FSoftObjectPath& Path : Event.ActionPaths)
+	{
+		FString PathString = Path.ToString();
+		Ar << PathString;
+		if (Ar.IsLoading())
+		{
+			Path.SetPath(PathString);
+		}
+	}
+
+	Ar << Event.Stacks;
+	Ar << Event.bRemoveAll;
+	Ar << Event.Value;
+	Ar << Event.Payload;
+
+	return Ar;
+}
+
+/*~ FRogueliteReplayLog ~*/
+
+bool FRogueliteReplayLog::Open(const FString& InFilePath, int32 RunSeed)
+{
+	Close();
+
+	Writer.Reset(IFileManager::Get().CreateFileWriter(*InFilePath, FILEWRITE_AllowRead));
+	if (!Writer.IsValid())
+	{
+		return false;
+	}
+
+	uint32 Magic = RogueliteReplay::Magic;
+	int32 Version = RogueliteReplay::Version;
+	*Writer << Magic;
+	*Writer << Version;
+	*Writer << RunSeed;
+	Writer->Flush();
+
+	FilePath = InFilePath;
+	return true;
+}
+
+bool FRogueliteReplayLog::Resume(const FString& InFilePath)
+{
+	Close();
+
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *InFilePath))
+	{
+		return false;
+	}
+
+	int32 RunSeed = 0;
+	TArray<FRogueliteReplayEvent> Events;
+	int64 ValidSize = 0;
+	if (!ParseLog(Data, RunSeed, Events, ValidSize))
+	{
+		return false;
+	}
+
+	// 잘린 레코드 뒤에 이어 쓰면 읽기가 그 지점에서 멈추므로 완전한 레코드까지만 남김
+	if (ValidSize < Data.Num())
+	{
+		Data.SetNum(ValidSize);
+		if (!FFileHelper::SaveArrayToFile(Data, *InFilePath))
+		{
+			return false;
+		}
+	}
+
+	Writer.Reset(IFileManager::Get().CreateFileWriter(*InFilePath, FILEWRITE_Append | FILEWRITE_AllowRead));
+	if (!Writer.IsValid())
+	{
+		return false;
+	}
+
+	FilePath = InFilePath;
+	return true;
+}
+
+void FRogueliteReplayLog::Close()
+{
+	if (Writer.IsValid())
+	{
+		Writer->Close();
+		Writer.Reset();
+	}
+	FilePath.Reset();
+}
+
+void FRogueliteReplayLog::Append(const FRogueliteReplayEvent& Event)
+{
+	if (!IsOpen())
+	{
+		return;
+	}
+
+	// [int32 크기][페이로드] 형식으로 한 번에 기록
+	WriteBuffer.Reset();
+	FMemoryWriter BufferWriter(WriteBuffer);
+
+	int32 PayloadSize = 0;
+	BufferWriter << PayloadSize;
+	BufferWriter << const_cast<FRogueliteReplayEvent&>(Event);
+
+	PayloadSize = WriteBuffer.Num() - sizeof(int32);
+	FMemory::Memcpy(WriteBuffer.GetData(), &PayloadSize, sizeof(int32));
+
+	// 레코드 단위로 flush해서 크래시 시 잘린 레코드가 최대 하나만 남도록 함
+	Writer->Serialize(WriteBuffer.GetData(), WriteBuffer.Num());
+	Writer->Flush();
+}
+
+bool FRogueliteReplayLog::LoadFromFile(const FString& InFilePath, int32& OutRunSeed, TArray<FRogueliteReplayEvent>& OutEvents, int64* OutValidSize)
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *InFilePath))
+	{
+		return false;
+	}
+
+	int64 ValidSize = 0;
+	const bool bLoaded = ParseLog(Data, OutRunSeed, OutEvents, ValidSize);
+	if (OutValidSize)
+	{
+		*OutValidSize = ValidSize;
+	}
+	return bLoaded;
+}
+
+bool FRogueliteReplayLog::ParseLog(const TArray<uint8>& Data, int32& OutRunSeed, TArray<FRogueliteReplayEvent>& OutEvents, int64& OutValidSize)
+{
+	FMemoryReader Reader(Data);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	Reader << Magic;
+	Reader << Version;
+	Reader << OutRunSeed;
+
+	if (Reader.IsError() || Magic != RogueliteReplay::Magic || Version != RogueliteReplay::Version)
+	{
+		return false;
+	}
+
+	OutEvents.Reset();
+	OutValidSize = Reader.Tell();
+	while (Reader.Tell() + static_cast<int64>(sizeof(int32)) <= Reader.TotalSize())
+	{
+		int32 PayloadSize = 0;
+		Reader << PayloadSize;
+
+		// 크래시로 잘린 마지막 레코드는 버림
+		if (PayloadSize <= 0 || Reader.Tell() + PayloadSize > Reader.TotalSize())
+		{
+			break;
+		}
+
+		const int64 RecordEnd = Reader.Tell() + PayloadSize;
+		FRogueliteReplayEvent& Event = OutEvents.AddDefaulted_GetRef();
+		Reader << Event;
+
+		if (Reader.IsError() || Reader.Tell() != RecordEnd)
+		{
+			OutEvents.Pop();
+			break;
+		}
+		OutValidSize = RecordEnd;
+	}
+
+	return true;
+}
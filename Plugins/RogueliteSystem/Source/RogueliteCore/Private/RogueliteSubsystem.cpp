@@ -2,14 +2,84 @@
 #include "RogueliteActionData.h"
 #include "RoguelitePoolPreset.h"
 #include "RogueliteQueryFilter.h"
+#include "RogueliteSettings.h"
+#include "RogueliteStats.h"
+#include "HAL/IConsoleManager.h"
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("ExecuteQuery"), STAT_RogueliteExecuteQuery, STATGROUP_Roguelite);
+DECLARE_CYCLE_STAT(TEXT("Query: Collect Candidates"), STAT_RogueliteCollectCandidates, STATGROUP_Roguelite);
+DECLARE_CYCLE_STAT(TEXT("Query: Filter"), STAT_RogueliteFilterCandidates, STATGROUP_Roguelite);
+DECLARE_CYCLE_STAT(TEXT("Query: Weighted Select"), STAT_RogueliteWeightedSelect, STATGROUP_Roguelite);
+DECLARE_CYCLE_STAT(TEXT("TryAcquireAction"), STAT_RogueliteTryAcquireAction, STATGROUP_Roguelite);
+DECLARE_CYCLE_STAT(TEXT("RemoveAction"), STAT_RogueliteRemoveAction, STATGROUP_Roguelite);
+DECLARE_CYCLE_STAT(TEXT("Apply Auto Effects"), STAT_RogueliteApplyAutoEffects, STATGROUP_Roguelite);
+DECLARE_CYCLE_STAT(TEXT("Remove Auto Effects"), STAT_RogueliteRemoveAutoEffects, STATGROUP_Roguelite);
+DECLARE_CYCLE_STAT(TEXT("CreateRunSaveData"), STAT_RogueliteCreateRunSaveData, STATGROUP_Roguelite);
+DECLARE_CYCLE_STAT(TEXT("RestoreRunFromSaveData"), STAT_RogueliteRestoreRunFromSaveData, STATGROUP_Roguelite);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Queries"), STAT_RogueliteQueries, STATGROUP_Roguelite);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Query Candidates"), STAT_RogueliteQueryCandidates, STATGROUP_Roguelite);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Query Rejected"), STAT_RogueliteQueryRejected, STATGROUP_Roguelite);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Acquires"), STAT_RogueliteAcquires, STATGROUP_Roguelite);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Query Scratch Growth"), STAT_RogueliteQueryScratchGrowth, STATGROUP_Roguelite);
+
+// 0이 아닌 새 런 시드 생성
+static int32 GenerateRunSeed()
+{
+	FRandomStream Seeder;
+	Seeder.GenerateNewSeed();
+	const int32 Seed = Seeder.GetCurrentSeed();
+	return Seed != 0 ? Seed : 1;
+}
+
+// QA 빌드에서 모든 쿼리를 explain 모드로 실행
+static TAutoConsoleVariable<bool> CVarRogueliteExplainQueries(
+	TEXT("Roguelite.ExplainQueries"),
+	false,
+	TEXT("Collect an explain report for every query (print with Roguelite.ExplainLastQuery)."));
+
+static FAutoConsoleCommandWithWorld CmdRogueliteExplainLastQuery(
+	TEXT("Roguelite.ExplainLastQuery"),
+	TEXT("Print the report of the last explained query."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		if (URogueliteSubsystem* Subsystem = URogueliteSubsystem::Get(World))
+		{
+			UE_LOG(LogRoguelite, Display, TEXT("%s"), *Subsystem->GetLastQueryReport().ToString());
+		}
+	}));
+
+// 리플레이 Restore 이벤트용 세이브 데이터 직렬화 (이름/경로는 문자열로 기록)
+static void SerializeSaveDataPayload(FArchive& Ar, FRogueliteRunSaveData& SaveData)
+{
+	FObjectAndNameAsStringProxyArchive Proxy(Ar, false);
+	FRogueliteRunSaveData::StaticStruct()->SerializeItem(Proxy, &SaveData, nullptr);
+}
+
+// Project Settings의 디버그 로깅 여부
+static bool IsDebugLoggingEnabled()
+{
+	return URogueliteSettings::Get()->bEnableDebugLogging;
+}
 
 /*~ USubsystem Interface ~*/
 
 void URogueliteSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+
+	// 런 밖에서 실행되는 쿼리도 매 실행마다 다른 결과가 나오도록 시드 지정
+	RunState.RandomSeed = GenerateRunSeed();
+
+	SnapshotTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &URogueliteSubsystem::TickRunStateSnapshot));
 }
 
 void URogueliteSubsystem::Deinitialize()
@@ -21,7 +91,16 @@ void URogueliteSubsystem::Deinitialize()
 
 	AllActions.Empty();
 	TagIndex.Empty();
+	NestedQueryScratch.Empty();
 	PreAcquireChecks.Empty();
+	BuiltPoolCache.Empty();
+	ReplayLog.Close();
+
+	FTSTicker::GetCoreTicker().RemoveTicker(SnapshotTickerHandle);
+	{
+		FWriteScopeLock WriteLock(SnapshotLock);
+		PublishedSnapshot.Reset();
+	}
 	
 	Super::Deinitialize();
 }
@@ -71,6 +150,8 @@ void URogueliteSubsystem::RegisterAction(URogueliteActionData* Action)
 	{
 		TagIndex.FindOrAdd(Tag).Add(Action);
 	}
+
+	MarkChanged(ERogueliteChangeCategory::ActionDB);
 }
 
 void URogueliteSubsystem::UnregisterAction(URogueliteActionData* Action)
@@ -85,7 +166,9 @@ void URogueliteSubsystem::UnregisterAction(URogueliteActionData* Action)
 		return;
 	}
 
+	// 인덱스 접근이 가능하도록 빈 칸 없이 순서 유지 압축
 	AllActions.Remove(Action);
+	AllActions.CompactStable();
 
 	// 태그 인덱스에서 제거
 	for (const FGameplayTag& Tag : Action->ActionTags)
@@ -93,8 +176,11 @@ void URogueliteSubsystem::UnregisterAction(URogueliteActionData* Action)
 		if (TSet<URogueliteActionData*>* Set = TagIndex.Find(Tag))
 		{
 			Set->Remove(Action);
+			Set->CompactStable();
 		}
 	}
+
+	MarkChanged(ERogueliteChangeCategory::ActionDB);
 }
 
 TArray<URogueliteActionData*> URogueliteSubsystem::GetAllActions() const
@@ -111,6 +197,46 @@ TArray<URogueliteActionData*> URogueliteSubsystem::GetActionsByTag(FGameplayTag
 	return TArray<URogueliteActionData*>();
 }
 
+int32 URogueliteSubsystem::GetActionCount() const
+{
+	return AllActions.Num();
+}
+
+URogueliteActionData* URogueliteSubsystem::GetActionAt(int32 Index) const
+{
+	if (!AllActions.IsValidId(FSetElementId::FromInteger(Index)))
+	{
+		return nullptr;
+	}
+	return AllActions[FSetElementId::FromInteger(Index)];
+}
+
+int32 URogueliteSubsystem::GetActionCountByTag(FGameplayTag Tag) const
+{
+	return GetActionsByTagRef(Tag).Num();
+}
+
+URogueliteActionData* URogueliteSubsystem::GetActionByTagAt(FGameplayTag Tag, int32 Index) const
+{
+	const TSet<URogueliteActionData*>& Set = GetActionsByTagRef(Tag);
+	if (!Set.IsValidId(FSetElementId::FromInteger(Index)))
+	{
+		return nullptr;
+	}
+	return Set[FSetElementId::FromInteger(Index)];
+}
+
+const TSet<URogueliteActionData*>& URogueliteSubsystem::GetActionsByTagRef(FGameplayTag Tag) const
+{
+	static const TSet<URogueliteActionData*> EmptySet;
+
+	if (const TSet<URogueliteActionData*>* Set = TagIndex.Find(Tag))
+	{
+		return *Set;
+	}
+	return EmptySet;
+}
+
 TArray<URogueliteActionData*> URogueliteSubsystem::GetActionsByTags(const FGameplayTagContainer& Tags, bool bRequireAll) const
 {
 	TArray<URogueliteActionData*> Result;
@@ -143,7 +269,7 @@ TArray<URogueliteActionData*> URogueliteSubsystem::GetActionsByTags(const FGamep
 
 /*~ Run Management ~*/
 
-void URogueliteSubsystem::StartRun()
+void URogueliteSubsystem::StartRun(int32 Seed)
 {
 	if (RunState.bActive)
 	{
@@ -152,6 +278,18 @@ void URogueliteSubsystem::StartRun()
 
 	RunState.Reset();
 	RunState.bActive = true;
+	RunState.RandomSeed = Seed != 0 ? Seed : GenerateRunSeed();
+	++RunStartCount;
+
+	// 리플레이 로그 시작
+	const URogueliteSettings* Settings = URogueliteSettings::Get();
+	if (!bReplaying && IsValid(Settings) && Settings->bEnableReplayLog)
+	{
+		const FString FileName = FString::Printf(TEXT("Run_%s_%d.rlog"), *FDateTime::Now().ToString(), RunState.RandomSeed);
+		ReplayLog.Open(FPaths::Combine(FPaths::ProjectSavedDir(), Settings->ReplayLogDirectory, FileName), RunState.RandomSeed);
+	}
+
+	MarkRunStateDirty();
 
 	OnRunStarted.Broadcast();
 }
@@ -164,6 +302,8 @@ void URogueliteSubsystem::EndRun(bool bCompleted)
 	}
 
 	RunState.bActive = false;
+	ReplayLog.Close();
+	MarkRunStateDirty();
 
 	OnRunEnded.Broadcast(bCompleted);
 }
@@ -173,37 +313,176 @@ bool URogueliteSubsystem::IsRunActive() const
 	return RunState.bActive;
 }
 
-FRogueliteRunState& URogueliteSubsystem::GetRunState()
+const FRogueliteRunState& URogueliteSubsystem::GetRunState() const
 {
 	return RunState;
 }
 
+void URogueliteSubsystem::MutateRunState(TFunctionRef<void(FRogueliteRunState&)> Mutator)
+{
+	Mutator(RunState);
+	MarkRunStateDirty();
+}
+
 const FRogueliteRunState& URogueliteSubsystem::GetRunStateConst() const
 {
 	return RunState;
 }
 
+int32 URogueliteSubsystem::GetRunSeed() const
+{
+	return RunState.RandomSeed;
+}
+
+int32 URogueliteSubsystem::GetRunStartCount() const
+{
+	return RunStartCount;
+}
+
+/*~ Snapshot ~*/
+
+FRogueliteRunStateSnapshotPtr URogueliteSubsystem::GetRunStateSnapshot()
+{
+	if (IsInGameThread())
+	{
+		PublishRunStateSnapshot();
+	}
+
+	FReadScopeLock ReadLock(SnapshotLock);
+	return PublishedSnapshot;
+}
+
+int32 URogueliteSubsystem::GetRunStateVersion() const
+{
+	return static_cast<int32>(RunStateVersion);
+}
+
+void URogueliteSubsystem::MarkRunStateDirty()
+{
+	// AcquiredActions/ActiveTags가 직접 수정되었을 수 있으므로 인덱스 재구성
+	RunState.RebuildAcquiredTagIndex();
+	RunState.RecomputeTagRefCounts();
+
+	MarkChanged(ERogueliteChangeCategory::Acquired);
+	MarkChanged(ERogueliteChangeCategory::Slots);
+	MarkChanged(ERogueliteChangeCategory::Tags);
+	MarkChanged(ERogueliteChangeCategory::Numeric);
+}
+
+int32 URogueliteSubsystem::GetChangeVersion(ERogueliteChangeCategory Category) const
+{
+	return static_cast<int32>(ChangeVersions[static_cast<int32>(Category)]);
+}
+
+void URogueliteSubsystem::MarkChanged(ERogueliteChangeCategory Category)
+{
+	++ChangeVersions[static_cast<int32>(Category)];
+
+	if (Category != ERogueliteChangeCategory::ActionDB)
+	{
+		++RunStateVersion;
+	}
+}
+
+void URogueliteSubsystem::PublishRunStateSnapshot()
+{
+	check(IsInGameThread());
+
+	if (PublishedSnapshotVersion == RunStateVersion)
+	{
+		return;
+	}
+
+	// 변경이 있을 때만 복사 (copy-on-write)
+	TSharedRef<FRogueliteRunStateSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FRogueliteRunStateSnapshot, ESPMode::ThreadSafe>();
+	Snapshot->Version = RunStateVersion;
+	Snapshot->State = RunState;
+
+	{
+		FWriteScopeLock WriteLock(SnapshotLock);
+		PublishedSnapshot = Snapshot;
+	}
+	PublishedSnapshotVersion = RunStateVersion;
+}
+
+bool URogueliteSubsystem::TickRunStateSnapshot(float DeltaTime)
+{
+	PublishRunStateSnapshot();
+	return true;
+}
+
 /*~ Query ~*/
 
 TArray<URogueliteActionData*> URogueliteSubsystem::ExecuteQuery(const FRogueliteQuery& InQuery)
 {
-	TArray<URogueliteActionData*> Candidates;
+	const TConstArrayView<URogueliteActionData*> QueryResults = RunQuery(InQuery);
+	TArray<URogueliteActionData*> Results(QueryResults.GetData(), QueryResults.Num());
+	BroadcastQueryComplete(InQuery, Results);
+	return Results;
+}
+
+int32 URogueliteSubsystem::ExecuteQueryInto(const FRogueliteQuery& InQuery, TArrayView<URogueliteActionData*> OutResults)
+{
+	const TConstArrayView<URogueliteActionData*> Results = RunQuery(InQuery);
+
+	// 버퍼가 작으면 앞에서부터 잘라서 기록
+	const int32 NumWritten = FMath::Min(Results.Num(), OutResults.Num());
+	for (int32 i = 0; i < NumWritten; ++i)
+	{
+		OutResults[i] = Results[i];
+	}
+
+	BroadcastQueryComplete(InQuery, OutResults.Left(NumWritten));
+	return NumWritten;
+}
+
+TConstArrayView<URogueliteActionData*> URogueliteSubsystem::RunQuery(const FRogueliteQuery& InQuery)
+{
+	ROGUELITE_SCOPE_CYCLE_COUNTER(STAT_RogueliteExecuteQuery);
+	INC_DWORD_STAT(STAT_RogueliteQueries);
+
+	// 커스텀 필터 등에서 쿼리 중에 다시 쿼리하면 깊이별 버퍼 사용 (바깥 쿼리 버퍼 보존)
+	const int32 Depth = QueryDepth;
+	while (NestedQueryScratch.Num() < Depth)
+	{
+		NestedQueryScratch.Add(MakeUnique<FRogueliteQueryScratch>());
+	}
+	FRogueliteQueryScratch& Scratch = Depth == 0 ? QueryScratch : *NestedQueryScratch[Depth - 1];
+	TGuardValue<int32> DepthGuard(QueryDepth, Depth + 1);
+
+	const SIZE_T ScratchSizeBefore = Scratch.GetAllocatedSize();
+
+	FRogueliteQueryReport* Report = nullptr;
+	if (InQuery.bExplain || CVarRogueliteExplainQueries.GetValueOnGameThread())
+	{
+		Report = &Scratch.Report;
+		Report->Reset();
+	}
+	uint64 StageStartCycles = FPlatformTime::Cycles64();
 
-	// 풀 태그 결정
-	FGameplayTagContainer EffectivePoolTags = InQuery.PoolTags;
-	FGameplayTagContainer EffectiveRequireTags = InQuery.RequireTags;
-	FGameplayTagContainer EffectiveExcludeTags = InQuery.ExcludeTags;
 	ERogueliteQueryMode EffectiveMode = InQuery.Mode;
 	bool bEffectiveExcludeMaxStacked = InQuery.bExcludeMaxStacked;
 	URogueliteQueryFilter* EffectiveCustomFilter = InQuery.CustomFilter;
 
+	// 프리셋이 있을 때만 태그를 임시 버퍼에 합침 (없으면 쿼리 컨테이너를 그대로 참조)
+	const bool bHasPreset = IsValid(InQuery.PoolPreset);
+	const FGameplayTagContainer& EffectivePoolTags = bHasPreset ? Scratch.PoolTags : InQuery.PoolTags;
+	const FGameplayTagContainer& EffectiveRequireTags = bHasPreset ? Scratch.RequireTags : InQuery.RequireTags;
+	const FGameplayTagContainer& EffectiveExcludeTags = bHasPreset ? Scratch.ExcludeTags : InQuery.ExcludeTags;
+
 	// 프리셋 적용
-	if (IsValid(InQuery.PoolPreset))
+	if (bHasPreset)
 	{
 		URoguelitePoolPreset* Preset = InQuery.PoolPreset;
-		EffectivePoolTags.AppendTags(Preset->PoolTags);
-		EffectiveRequireTags.AppendTags(Preset->RequireTags);
-		EffectiveExcludeTags.AppendTags(Preset->ExcludeTags);
+		Scratch.PoolTags.Reset();
+		Scratch.PoolTags.AppendTags(InQuery.PoolTags);
+		Scratch.PoolTags.AppendTags(Preset->PoolTags);
+		Scratch.RequireTags.Reset();
+		Scratch.RequireTags.AppendTags(InQuery.RequireTags);
+		Scratch.RequireTags.AppendTags(Preset->RequireTags);
+		Scratch.ExcludeTags.Reset();
+		Scratch.ExcludeTags.AppendTags(InQuery.ExcludeTags);
+		Scratch.ExcludeTags.AppendTags(Preset->ExcludeTags);
 
 		if (InQuery.Mode == ERogueliteQueryMode::All)
 		{
@@ -217,85 +496,277 @@ TArray<URogueliteActionData*> URogueliteSubsystem::ExecuteQuery(const FRoguelite
 		}
 	}
 
+	// 풀별 비용 구분용 트레이스 스코프 (기존 FName 재사용, 문자열 생성 없음)
+	static const FName MultiPoolScopeName(TEXT("RogueliteMultiPoolQuery"));
+	const FName PoolScopeName = IsValid(InQuery.PoolPreset) ? InQuery.PoolPreset->GetFName()
+		: EffectivePoolTags.Num() == 1 ? EffectivePoolTags.First().GetTagName()
+		: MultiPoolScopeName;
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(PoolScopeName, RogueliteChannel);
+
 	// 후보 수집
-	if (EffectivePoolTags.IsEmpty())
+	TArray<URogueliteActionData*>& Candidates = Scratch.Candidates;
+	Candidates.Reset();
 	{
-		Candidates = AllActions.Array();
-	}
-	else
-	{
-		TSet<URogueliteActionData*> CandidateSet;
-		for (const FGameplayTag& Tag : EffectivePoolTags)
+		ROGUELITE_SCOPE_CYCLE_COUNTER(STAT_RogueliteCollectCandidates);
+
+		if (EffectivePoolTags.IsEmpty())
 		{
-			if (const TSet<URogueliteActionData*>* Set = TagIndex.Find(Tag))
+			Candidates.Reserve(AllActions.Num());
+			for (URogueliteActionData* Action : AllActions)
 			{
-				CandidateSet.Append(*Set);
+				Candidates.Add(Action);
 			}
 		}
-		Candidates = CandidateSet.Array();
+		else if (EffectivePoolTags.Num() == 1)
+		{
+			// 풀 태그가 하나면 중복 제거 불필요
+			if (const TSet<URogueliteActionData*>* Set = TagIndex.Find(EffectivePoolTags.First()))
+			{
+				Candidates.Reserve(Set->Num());
+				for (URogueliteActionData* Action : *Set)
+				{
+					Candidates.Add(Action);
+				}
+			}
+		}
+		else
+		{
+			TSet<URogueliteActionData*>& CandidateSet = Scratch.CandidateSet;
+			CandidateSet.Reset();
+			for (const FGameplayTag& Tag : EffectivePoolTags)
+			{
+				if (const TSet<URogueliteActionData*>* Set = TagIndex.Find(Tag))
+				{
+					CandidateSet.Append(*Set);
+				}
+			}
+
+			Candidates.Reserve(CandidateSet.Num());
+			for (URogueliteActionData* Action : CandidateSet)
+			{
+				Candidates.Add(Action);
+			}
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_RogueliteQueryCandidates, Candidates.Num());
+
+	if (Report)
+	{
+		Report->PoolName = IsValid(InQuery.PoolPreset) ? InQuery.PoolPreset->GetName() : EffectivePoolTags.ToStringSimple();
+		Report->NumCandidates = Candidates.Num();
+		Report->CollectTimeMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StageStartCycles);
+		StageStartCycles = FPlatformTime::Cycles64();
 	}
 
 	// 필터링
-	TArray<URogueliteActionData*> Filtered;
-	for (URogueliteActionData* Action : Candidates)
+	TArray<URogueliteActionData*>& Filtered = Scratch.Filtered;
+	Filtered.Reset();
 	{
-		if (!IsValid(Action))
-		{
-			continue;
-		}
+		ROGUELITE_SCOPE_CYCLE_COUNTER(STAT_RogueliteFilterCandidates);
 
-		// RequireTags 체크
-		if (!EffectiveRequireTags.IsEmpty() && !Action->HasAllTags(EffectiveRequireTags))
+		// explain 모드일 때만 단계별 결과/시간 기록
+		auto PassesStage = [Report](ERogueliteQueryStage Stage, auto&& Check) -> bool
 		{
-			continue;
-		}
+			if (!Report)
+			{
+				return Check();
+			}
 
-		// ExcludeTags 체크
-		if (!EffectiveExcludeTags.IsEmpty() && Action->HasAnyTags(EffectiveExcludeTags))
-		{
-			continue;
-		}
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			const bool bPassed = Check();
+			Report->RecordStage(Stage, bPassed, FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+			return bPassed;
+		};
 
-		// 조건 체크 (RequiredTags, BlockedByTags)
-		if (!Action->MeetsConditions(RunState.ActiveTags))
+		// 모든 단계 통과 여부 (병렬 경로에서는 Report가 없으므로 워커 스레드에서 호출 가능)
+		auto PassesFilters = [&](URogueliteActionData* Action) -> bool
 		{
-			continue;
-		}
+			if (!PassesStage(ERogueliteQueryStage::Invalid, [&]() { return IsValid(Action); }))
+			{
+				return false;
+			}
 
-		// MaxStacked 체크
-		if (bEffectiveExcludeMaxStacked)
+			// RequireTags 체크
+			if (!PassesStage(ERogueliteQueryStage::RequireTags, [&]() { return EffectiveRequireTags.IsEmpty() || Action->HasAllTags(EffectiveRequireTags); }))
+			{
+				return false;
+			}
+
+			// ExcludeTags 체크
+			if (!PassesStage(ERogueliteQueryStage::ExcludeTags, [&]() { return EffectiveExcludeTags.IsEmpty() || !Action->HasAnyTags(EffectiveExcludeTags); }))
+			{
+				return false;
+			}
+
+			// 조건 체크 (RequiredTags, BlockedByTags)
+			if (!PassesStage(ERogueliteQueryStage::Conditions, [&]() { return Action->MeetsConditions(RunState.ActiveTags); }))
+			{
+				return false;
+			}
+
+			// MaxStacked 체크
+			if (bEffectiveExcludeMaxStacked && !PassesStage(ERogueliteQueryStage::MaxStacked, [&]() { return !Action->IsMaxStacked(RunState.GetStacks(Action)); }))
+			{
+				return false;
+			}
+
+			// 모드 체크
+			if (!PassesStage(ERogueliteQueryStage::Mode, [&]() { return PassesQueryMode(Action, EffectiveMode); }))
+			{
+				return false;
+			}
+
+			// 커스텀 필터 체크
+			if (IsValid(EffectiveCustomFilter) && !PassesStage(ERogueliteQueryStage::CustomFilter, [&]() { return EffectiveCustomFilter->Evaluate(Action, RunState, Report); }))
+			{
+				return false;
+			}
+
+			return true;
+		};
+
+		const URogueliteSettings* Settings = URogueliteSettings::Get();
+		const bool bParallel = !Report
+			&& Settings->bParallelQueryFiltering
+			&& Candidates.Num() >= Settings->ParallelFilterThreshold
+			&& (!IsValid(EffectiveCustomFilter) || EffectiveCustomFilter->IsThreadSafe());
+
+		if (bParallel)
 		{
-			int32 CurrentStacks = RunState.GetStacks(Action);
-			if (Action->IsMaxStacked(CurrentStacks))
+			// 워커는 후보별 통과 여부만 기록하고 수집은 원래 순서대로 (결과 순서 결정적)
+			TArray<bool>& PassMask = Scratch.PassMask;
+			PassMask.SetNumUninitialized(Candidates.Num(), EAllowShrinking::No);
+
+			const int32 BatchSize = FMath::Max(Settings->ParallelFilterBatchSize, 1);
+			const int32 NumBatches = FMath::DivideAndRoundUp(Candidates.Num(), BatchSize);
+			ParallelFor(NumBatches, [&](int32 BatchIndex)
 			{
-				continue;
+				const int32 Start = BatchIndex * BatchSize;
+				const int32 End = FMath::Min(Start + BatchSize, Candidates.Num());
+				for (int32 i = Start; i < End; ++i)
+				{
+					PassMask[i] = PassesFilters(Candidates[i]);
+				}
+			});
+
+			for (int32 i = 0; i < Candidates.Num(); ++i)
+			{
+				if (PassMask[i])
+				{
+					Filtered.Add(Candidates[i]);
+				}
 			}
 		}
-
-		// 모드 체크
-		if (!PassesQueryMode(Action, EffectiveMode))
+		else
 		{
-			continue;
+			for (URogueliteActionData* Action : Candidates)
+			{
+				if (PassesFilters(Action))
+				{
+					Filtered.Add(Action);
+				}
+			}
 		}
+	}
 
-		// 커스텀 필터 체크
-		if (IsValid(EffectiveCustomFilter) && !EffectiveCustomFilter->PassesFilter(Action, RunState))
+	INC_DWORD_STAT_BY(STAT_RogueliteQueryRejected, Candidates.Num() - Filtered.Num());
+
+	if (Report)
+	{
+		Report->NumPassed = Filtered.Num();
+		Report->FilterTimeMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StageStartCycles);
+		StageStartCycles = FPlatformTime::Cycles64();
+	}
+
+	// 랜덤 스트림 결정 (명시 시드 > 풀별 런 스트림)
+	const bool bUseRunStream = InQuery.RandomSeed == 0;
+	const FGameplayTag StreamKey = InQuery.RandomStreamTag.IsValid() ? InQuery.RandomStreamTag : EffectivePoolTags.First();
+	FRandomStream QuerySeedStream(InQuery.RandomSeed);
+	FRandomStream& RandomStream = bUseRunStream ? RunState.GetRandomStream(StreamKey) : QuerySeedStream;
+	const int32 StreamStateBefore = RandomStream.GetCurrentSeed();
+
+	// 가중치 기반 선택
+	TArray<URogueliteActionData*>& Results = Scratch.Results;
+	WeightedSelect(Filtered, InQuery, RandomStream, Scratch, Results);
+
+	if (Report)
+	{
+		Report->NumSelected = Results.Num();
+		Report->SelectTimeMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StageStartCycles);
+		LastQueryReport = *Report;
+	}
+
+	// 랜덤 스트림 변경은 분류별 버전 없이 전체 버전만 갱신
+	if (bUseRunStream && RandomStream.GetCurrentSeed() != StreamStateBefore)
+	{
+		++RunStateVersion;
+	}
+
+	// 리플레이 기록 (명시 시드 쿼리는 런 상태에 영향 없음)
+	if (bUseRunStream && ReplayLog.IsOpen())
+	{
+		FRogueliteReplayEvent& Event = Scratch.ReplayEvent;
+		Event.Type = ERogueliteReplayEventType::Query;
+		Event.Tag = StreamKey;
+		Event.StreamStateBefore = StreamStateBefore;
+		Event.StreamStateAfter = RandomStream.GetCurrentSeed();
+		Event.ActionPaths.Reset();
+		for (URogueliteActionData* Action : Results)
 		{
-			continue;
+			Event.ActionPaths.Add(FSoftObjectPath(Action));
 		}
+		ReplayLog.Append(Event);
+	}
 
-		Filtered.Add(Action);
+	// 임시 버퍼가 커졌으면 기록 (정상 상태에서는 0이어야 함)
+	if (Scratch.GetAllocatedSize() != ScratchSizeBefore)
+	{
+		++QueryScratchGrowthCount;
+		INC_DWORD_STAT(STAT_RogueliteQueryScratchGrowth);
 	}
 
-	// 가중치 기반 선택
-	TArray<URogueliteActionData*> Results = WeightedSelect(Filtered, InQuery);
+	if (IsDebugLoggingEnabled())
+	{
+		UE_LOG(LogRoguelite, Log, TEXT("Query [%s]: %d candidates, %d passed, %d selected"),
+			IsValid(InQuery.PoolPreset) ? *InQuery.PoolPreset->GetName() : *EffectivePoolTags.ToStringSimple(),
+			Candidates.Num(), Filtered.Num(), Results.Num());
+	}
 
-	// 이벤트 발생
-	OnQueryComplete.Broadcast(InQuery, Results);
+	return Results;
+}
+
+void URogueliteSubsystem::BroadcastQueryComplete(const FRogueliteQuery& InQuery, TConstArrayView<URogueliteActionData*> Results)
+{
+	OnQueryCompleteNative.Broadcast(InQuery, Results);
 
+	// 다이나믹 델리게이트는 파라미터를 복사하므로 바인딩이 있을 때만 배열 생성
+	if (OnQueryComplete.IsBound())
+	{
+		OnQueryComplete.Broadcast(InQuery, TArray<URogueliteActionData*>(Results.GetData(), Results.Num()));
+	}
+}
+
+TArray<URogueliteActionData*> URogueliteSubsystem::ExecuteQueryWithReport(const FRogueliteQuery& InQuery, FRogueliteQueryReport& OutReport)
+{
+	FRogueliteQuery ExplainQuery = InQuery;
+	ExplainQuery.bExplain = true;
+
+	TArray<URogueliteActionData*> Results = ExecuteQuery(ExplainQuery);
+	OutReport = LastQueryReport;
 	return Results;
 }
 
+const FRogueliteQueryReport& URogueliteSubsystem::GetLastQueryReport() const
+{
+	return LastQueryReport;
+}
+
+int32 URogueliteSubsystem::GetQueryScratchGrowthCount() const
+{
+	return QueryScratchGrowthCount;
+}
+
 TArray<URogueliteActionData*> URogueliteSubsystem::QuerySimple(URoguelitePoolPreset* Preset, int32 Count)
 {
 	FRogueliteQuery QueryStruct;
@@ -313,6 +784,70 @@ TArray<URogueliteActionData*> URogueliteSubsystem::QueryByTag(FGameplayTag PoolT
 	return ExecuteQuery(QueryStruct);
 }
 
+TArray<int32> URogueliteSubsystem::DrawFromWeightedPool(const FRogueliteWeightedPool& Pool, FGameplayTag StreamKey, int32 Count, bool bUnique)
+{
+	TArray<int32> Results;
+
+	// BP에서 Build 없이 넘긴 풀은 캐시된 빌드 결과 사용
+	const FRogueliteWeightedPool& DrawPool = Pool.IsBuilt() ? Pool : FindOrBuildPool(Pool);
+
+	FRandomStream& RandomStream = RunState.GetRandomStream(StreamKey);
+	const int32 StreamStateBefore = RandomStream.GetCurrentSeed();
+
+	if (bUnique)
+	{
+		DrawPool.DrawUnique(RandomStream, Count, Results, &PoolDrawScratch);
+	}
+	else
+	{
+		DrawPool.DrawMany(RandomStream, Count, Results);
+	}
+
+	if (RandomStream.GetCurrentSeed() != StreamStateBefore)
+	{
+		++RunStateVersion;
+
+		// 결과는 호출자가 쓰고 런 상태에는 스트림 위치만 남으므로 스트림 진행만 기록
+		if (ReplayLog.IsOpen())
+		{
+			FRogueliteReplayEvent Event;
+			Event.Type = ERogueliteReplayEventType::DrawPool;
+			Event.Tag = StreamKey;
+			Event.StreamStateBefore = StreamStateBefore;
+			Event.StreamStateAfter = RandomStream.GetCurrentSeed();
+			ReplayLog.Append(Event);
+		}
+	}
+
+	return Results;
+}
+
+const FRogueliteWeightedPool& URogueliteSubsystem::FindOrBuildPool(const FRogueliteWeightedPool& Pool)
+{
+	const uint32 Hash = Pool.GetContentHash();
+	if (FRogueliteWeightedPool* Cached = BuiltPoolCache.Find(Hash))
+	{
+		if (Cached->HasSameContent(Pool))
+		{
+			return *Cached;
+		}
+
+		// 해시 충돌: 새 내용으로 교체
+		*Cached = Pool;
+		Cached->Build();
+		return *Cached;
+	}
+
+	if (BuiltPoolCache.Num() >= MaxBuiltPoolCacheSize)
+	{
+		BuiltPoolCache.Reset();
+	}
+
+	FRogueliteWeightedPool& Built = BuiltPoolCache.Add(Hash, Pool);
+	Built.Build();
+	return Built;
+}
+
 bool URogueliteSubsystem::PassesQueryMode(URogueliteActionData* Action, ERogueliteQueryMode Mode) const
 {
 	bool bAcquired = RunState.HasAction(Action);
@@ -340,93 +875,45 @@ bool URogueliteSubsystem::PassesQueryMode(URogueliteActionData* Action, ERogueli
 	return true;
 }
 
-TArray<URogueliteActionData*> URogueliteSubsystem::WeightedSelect(const TArray<URogueliteActionData*>& Candidates, const FRogueliteQuery& InQuery)
+void URogueliteSubsystem::WeightedSelect(const TArray<URogueliteActionData*>& Candidates, const FRogueliteQuery& InQuery, FRandomStream& RandomStream, FRogueliteQueryScratch& Scratch, TArray<URogueliteActionData*>& OutResults)
 {
+	ROGUELITE_SCOPE_CYCLE_COUNTER(STAT_RogueliteWeightedSelect);
+
+	OutResults.Reset();
+
 	if (Candidates.Num() == 0 || InQuery.Count <= 0)
 	{
-		return TArray<URogueliteActionData*>();
+		return;
 	}
 
 	if (Candidates.Num() <= InQuery.Count)
 	{
-		return Candidates;
-	}
-
-	// 랜덤 스트림 설정
-	FRandomStream RandomStream;
-	if (InQuery.RandomSeed != 0)
-	{
-		RandomStream.Initialize(InQuery.RandomSeed);
-	}
-	else
-	{
-		RandomStream.GenerateNewSeed();
+		OutResults.Append(Candidates);
+		return;
 	}
 
-	// 가중치 계산
-	TArray<float> Weights;
+	// 가중치 계산 (배율 적용)
+	TArray<float>& Weights = Scratch.Weights;
+	Weights.Reset();
 	Weights.Reserve(Candidates.Num());
 
 	for (URogueliteActionData* Action : Candidates)
 	{
-		float Weight = Action->BaseWeight;
-
-		// 가중치 배율 적용
-		for (const auto& Modifier : InQuery.WeightModifiers)
-		{
-			if (Action->HasTag(Modifier.Key))
-			{
-				Weight *= Modifier.Value;
-			}
-		}
-
-		Weights.Add(FMath::Max(Weight, 0.f));
+		Weights.Add(FRogueliteWeightedPool::ApplyWeightModifiers(Action->BaseWeight, Action->ActionTags, InQuery.WeightModifiers));
 	}
 
-	// 가중치 기반 선택
-	TArray<URogueliteActionData*> Results;
-	TArray<int32> AvailableIndices;
-	for (int32 i = 0; i < Candidates.Num(); ++i)
-	{
-		AvailableIndices.Add(i);
-	}
+	FRogueliteWeightedPool& Pool = Scratch.Pool;
+	Pool.BuildFromWeights(TConstArrayView<float>(Weights));
 
-	for (int32 i = 0; i < InQuery.Count && AvailableIndices.Num() > 0; ++i)
-	{
-		float TotalWeight = 0.f;
-		for (int32 Idx : AvailableIndices)
-		{
-			TotalWeight += Weights[Idx];
-		}
+	// 중복 없이 선택
+	TArray<int32>& PickedIndices = Scratch.PickedIndices;
+	Pool.DrawUnique(RandomStream, InQuery.Count, PickedIndices, &Scratch.DrawScratch);
 
-		if (TotalWeight <= 0.f)
-		{
-			// 모든 가중치가 0이면 균등 확률
-			int32 RandomIdx = RandomStream.RandRange(0, AvailableIndices.Num() - 1);
-			Results.Add(Candidates[AvailableIndices[RandomIdx]]);
-			AvailableIndices.RemoveAt(RandomIdx);
-		}
-		else
-		{
-			float Random = RandomStream.FRandRange(0.f, TotalWeight);
-			float Cumulative = 0.f;
-
-			for (int32 j = 0; j < AvailableIndices.Num(); ++j)
-			{
-				int32 Idx = AvailableIndices[j];
-				Cumulative += Weights[Idx];
-
-				if (Random <= Cumulative)
-				{
-					Results.Add(Candidates[Idx]);
-					AvailableIndices.RemoveAt(j);
-					break;
-				}
-			}
-		}
+	OutResults.Reserve(PickedIndices.Num());
+	for (int32 Idx : PickedIndices)
+	{
+		OutResults.Add(Candidates[Idx]);
 	}
-
-	return Results;
 }
 
 /*~ Action Management ~*/
@@ -439,6 +926,24 @@ bool URogueliteSubsystem::AcquireAction(URogueliteActionData* Action, int32 Stac
 
 bool URogueliteSubsystem::TryAcquireAction(URogueliteActionData* Action, FString& OutFailReason, int32 StacksToAdd)
 {
+	ROGUELITE_SCOPE_CYCLE_COUNTER(STAT_RogueliteTryAcquireAction);
+
+	bool bAcquired = false;
+	ON_SCOPE_EXIT
+	{
+		if (IsDebugLoggingEnabled())
+		{
+			if (bAcquired)
+			{
+				UE_LOG(LogRoguelite, Log, TEXT("Acquired %s (x%d)"), *GetNameSafe(Action), RunState.GetStacks(Action));
+			}
+			else
+			{
+				UE_LOG(LogRoguelite, Log, TEXT("Acquire %s failed: %s"), *GetNameSafe(Action), *OutFailReason);
+			}
+		}
+	};
+
 	if (!IsValid(Action))
 	{
 		OutFailReason = TEXT("Invalid action");
@@ -484,26 +989,40 @@ bool URogueliteSubsystem::TryAcquireAction(URogueliteActionData* Action, FString
 
 	int32 ActualStacksAdded = NewStacks - OldStacks;
 
-	// 상태 업데이트
-	FRogueliteAcquiredInfo& Info = RunState.AcquiredActions.FindOrAdd(Action);
+	// 상태 업데이트 (태그 인덱스 포함)
+	RunState.SetStacks(Action, NewStacks);
 	if (OldStacks == 0)
 	{
-		Info.AcquiredTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
+		RunState.AcquiredActions[Action].AcquiredTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
 	}
-	Info.Stacks = NewStacks;
 
 	// 자동 효과 적용
 	ApplyAutoEffects(Action, ActualStacksAdded);
 
+	if (ReplayLog.IsOpen())
+	{
+		FRogueliteReplayEvent Event;
+		Event.Type = ERogueliteReplayEventType::Acquire;
+		Event.ActionPaths.Add(FSoftObjectPath(Action));
+		Event.Stacks = ActualStacksAdded;
+		ReplayLog.Append(Event);
+	}
+
+	MarkChanged(ERogueliteChangeCategory::Acquired);
+
 	// 이벤트 발생
 	OnActionAcquired.Broadcast(Action, OldStacks, NewStacks);
 	OnStackChanged.Broadcast(Action, OldStacks, NewStacks);
 
+	INC_DWORD_STAT(STAT_RogueliteAcquires);
+	bAcquired = true;
 	return true;
 }
 
 bool URogueliteSubsystem::RemoveAction(URogueliteActionData* Action, int32 StacksToRemove, bool bRemoveAll)
 {
+	ROGUELITE_SCOPE_CYCLE_COUNTER(STAT_RogueliteRemoveAction);
+
 	if (!IsValid(Action))
 	{
 		return false;
@@ -526,15 +1045,20 @@ bool URogueliteSubsystem::RemoveAction(URogueliteActionData* Action, int32 Stack
 	// 자동 효과 제거
 	RemoveAutoEffects(Action, ActualStacksRemoved);
 
-	if (NewStacks == 0)
-	{
-		RunState.AcquiredActions.Remove(Action);
-	}
-	else
+	RunState.SetStacks(Action, NewStacks);
+
+	if (ReplayLog.IsOpen())
 	{
-		RunState.AcquiredActions[Action].Stacks = NewStacks;
+		FRogueliteReplayEvent Event;
+		Event.Type = ERogueliteReplayEventType::Remove;
+		Event.ActionPaths.Add(FSoftObjectPath(Action));
+		Event.Stacks = ActualStacksRemoved;
+		Event.bRemoveAll = bRemoveAll;
+		ReplayLog.Append(Event);
 	}
 
+	MarkChanged(ERogueliteChangeCategory::Acquired);
+
 	// 이벤트 발생
 	OnActionRemoved.Broadcast(Action, OldStacks, NewStacks);
 	OnStackChanged.Broadcast(Action, OldStacks, NewStacks);
@@ -559,29 +1083,108 @@ TArray<URogueliteActionData*> URogueliteSubsystem::GetAllAcquired() const
 	return Result;
 }
 
-TArray<URogueliteActionData*> URogueliteSubsystem::GetAcquiredWithTag(FGameplayTag Tag) const
+int32 URogueliteSubsystem::GetAcquiredCount() const
 {
-	TArray<URogueliteActionData*> Result;
-	for (const auto& Pair : RunState.AcquiredActions)
+	return RunState.AcquiredActions.Num();
+}
+
+URogueliteActionData* URogueliteSubsystem::GetAcquiredAt(int32 Index) const
+{
+	const TArray<URogueliteActionData*>& Acquired = GetAcquiredArrayRef();
+	return Acquired.IsValidIndex(Index) ? Acquired[Index] : nullptr;
+}
+
+const TArray<URogueliteActionData*>& URogueliteSubsystem::GetAcquiredArrayRef() const
+{
+	const uint32 AcquiredVersion = ChangeVersions[static_cast<int32>(ERogueliteChangeCategory::Acquired)];
+	if (AcquiredArrayCacheVersion != AcquiredVersion)
 	{
-		if (IsValid(Pair.Key) && Pair.Key->HasTag(Tag))
-		{
-			Result.Add(Pair.Key);
-		}
+		AcquiredArrayCache.Reset();
+		RunState.AcquiredActions.GetKeys(AcquiredArrayCache);
+		AcquiredArrayCacheVersion = AcquiredVersion;
 	}
-	return Result;
+	return AcquiredArrayCache;
+}
+
+TArray<URogueliteActionData*> URogueliteSubsystem::GetAcquiredWithTag(FGameplayTag Tag) const
+{
+	return RunState.GetAcquiredWithTag(Tag);
+}
+
+int32 URogueliteSubsystem::GetAcquiredCountWithTag(FGameplayTag Tag) const
+{
+	return RunState.GetAcquiredCountWithTag(Tag);
+}
+
+int32 URogueliteSubsystem::GetAcquiredStacksWithTag(FGameplayTag Tag) const
+{
+	return RunState.GetAcquiredStacksWithTag(Tag);
 }
 
 /*~ Tags ~*/
 
 void URogueliteSubsystem::AddTagToSystem(FGameplayTag Tag)
 {
-	RunState.ActiveTags.AddTag(Tag);
+	if (!Tag.IsValid())
+	{
+		return;
+	}
+
+	++RunState.SystemTagCounts.FindOrAdd(Tag);
+	AddTagRef(Tag);
+	AppendTagReplayEvent(ERogueliteReplayEventType::AddTag, Tag);
 }
 
 void URogueliteSubsystem::RemoveTagFromSystem(FGameplayTag Tag)
 {
-	RunState.ActiveTags.RemoveTag(Tag);
+	// 시스템이 부여하지 않은 참조는 액션 소유이므로 해제하지 않음
+	int32* Count = RunState.SystemTagCounts.Find(Tag);
+	if (Count == nullptr)
+	{
+		return;
+	}
+
+	if (--(*Count) <= 0)
+	{
+		RunState.SystemTagCounts.Remove(Tag);
+	}
+	RemoveTagRef(Tag);
+	AppendTagReplayEvent(ERogueliteReplayEventType::RemoveTag, Tag);
+}
+
+void URogueliteSubsystem::AppendTagReplayEvent(ERogueliteReplayEventType Type, FGameplayTag Tag)
+{
+	if (ReplayLog.IsOpen())
+	{
+		FRogueliteReplayEvent Event;
+		Event.Type = Type;
+		Event.Tag = Tag;
+		ReplayLog.Append(Event);
+	}
+}
+
+int32 URogueliteSubsystem::GetTagRefCount(FGameplayTag Tag) const
+{
+	return RunState.GetTagRefCount(Tag);
+}
+
+void URogueliteSubsystem::AddTagRef(FGameplayTag Tag)
+{
+	// 0 -> 1 전환일 때만 태그 버전 증가 (조건 캐시 무효화 최소화)
+	if (RunState.AddTagRef(Tag))
+	{
+		MarkChanged(ERogueliteChangeCategory::Tags);
+		OnActiveTagChanged.Broadcast(Tag, true);
+	}
+}
+
+void URogueliteSubsystem::RemoveTagRef(FGameplayTag Tag)
+{
+	if (RunState.RemoveTagRef(Tag))
+	{
+		MarkChanged(ERogueliteChangeCategory::Tags);
+		OnActiveTagChanged.Broadcast(Tag, false);
+	}
 }
 
 bool URogueliteSubsystem::HasTagInSystem(FGameplayTag Tag) const
@@ -602,6 +1205,8 @@ void URogueliteSubsystem::SetRunStateValue(FGameplayTag Key, float Value)
 	if (!FMath::IsNearlyEqual(OldValue, Value))
 	{
 		RunState.SetNumericValue(Key, Value);
+		MarkChanged(ERogueliteChangeCategory::Numeric);
+		AppendValueReplayEvent(Key, Value);
 		OnRunStateValueChanged.Broadcast(Key, OldValue, Value);
 	}
 }
@@ -618,16 +1223,61 @@ float URogueliteSubsystem::AddRunStateValue(FGameplayTag Key, float Delta)
 	if (!FMath::IsNearlyEqual(OldValue, NewValue))
 	{
 		RunState.SetNumericValue(Key, NewValue);
+		MarkChanged(ERogueliteChangeCategory::Numeric);
+		AppendValueReplayEvent(Key, NewValue);
 		OnRunStateValueChanged.Broadcast(Key, OldValue, NewValue);
 	}
 	return NewValue;
 }
 
+void URogueliteSubsystem::AppendValueReplayEvent(FGameplayTag Key, float Value)
+{
+	// 더하기도 결과 값으로 기록 (재현 시 부동소수 누적 오차 없음)
+	if (ReplayLog.IsOpen())
+	{
+		FRogueliteReplayEvent Event;
+		Event.Type = ERogueliteReplayEventType::SetValue;
+		Event.Tag = Key;
+		Event.Value = Value;
+		ReplayLog.Append(Event);
+	}
+}
+
 TMap<FGameplayTag, float> URogueliteSubsystem::GetAllRunStateValues() const
 {
 	return RunState.NumericData;
 }
 
+int32 URogueliteSubsystem::GetRunStateValueCount() const
+{
+	return RunState.NumericData.Num();
+}
+
+bool URogueliteSubsystem::GetRunStateValueAt(int32 Index, FGameplayTag& OutKey, float& OutValue) const
+{
+	const uint32 NumericVersion = ChangeVersions[static_cast<int32>(ERogueliteChangeCategory::Numeric)];
+	if (NumericKeyCacheVersion != NumericVersion)
+	{
+		NumericKeyCache.Reset();
+		RunState.NumericData.GetKeys(NumericKeyCache);
+		NumericKeyCacheVersion = NumericVersion;
+	}
+
+	if (!NumericKeyCache.IsValidIndex(Index))
+	{
+		return false;
+	}
+
+	OutKey = NumericKeyCache[Index];
+	OutValue = RunState.GetNumericValue(OutKey);
+	return true;
+}
+
+const TMap<FGameplayTag, float>& URogueliteSubsystem::GetRunStateValuesRef() const
+{
+	return RunState.NumericData;
+}
+
 /*~ Slots ~*/
 
 bool URogueliteSubsystem::EquipActionToSlot(URogueliteActionData* Action, FGameplayTag SlotTag)
@@ -649,6 +1299,17 @@ bool URogueliteSubsystem::EquipActionToSlot(URogueliteActionData* Action, FGamep
 	}
 
 	SlotData.Actions.Add(Action);
+	MarkChanged(ERogueliteChangeCategory::Slots);
+
+	if (ReplayLog.IsOpen())
+	{
+		FRogueliteReplayEvent Event;
+		Event.Type = ERogueliteReplayEventType::Equip;
+		Event.Tag = SlotTag;
+		Event.ActionPaths.Add(FSoftObjectPath(Action));
+		ReplayLog.Append(Event);
+	}
+
 	return true;
 }
 
@@ -661,7 +1322,19 @@ void URogueliteSubsystem::UnequipActionFromSlot(URogueliteActionData* Action, FG
 
 	if (FRogueliteSlotArray* SlotData = RunState.Slots.Find(SlotTag))
 	{
-		SlotData->Actions.Remove(Action);
+		if (SlotData->Actions.Remove(Action) > 0)
+		{
+			MarkChanged(ERogueliteChangeCategory::Slots);
+
+			if (ReplayLog.IsOpen())
+			{
+				FRogueliteReplayEvent Event;
+				Event.Type = ERogueliteReplayEventType::Unequip;
+				Event.Tag = SlotTag;
+				Event.ActionPaths.Add(FSoftObjectPath(Action));
+				ReplayLog.Append(Event);
+			}
+		}
 	}
 }
 
@@ -674,6 +1347,23 @@ TArray<URogueliteActionData*> URogueliteSubsystem::GetSlotContents(FGameplayTag
 	return TArray<URogueliteActionData*>();
 }
 
+URogueliteActionData* URogueliteSubsystem::GetSlotActionAt(FGameplayTag SlotTag, int32 Index) const
+{
+	const TArray<URogueliteActionData*>& Contents = GetSlotContentsRef(SlotTag);
+	return Contents.IsValidIndex(Index) ? Contents[Index] : nullptr;
+}
+
+const TArray<URogueliteActionData*>& URogueliteSubsystem::GetSlotContentsRef(FGameplayTag SlotTag) const
+{
+	static const TArray<URogueliteActionData*> EmptySlot;
+
+	if (const FRogueliteSlotArray* SlotData = RunState.Slots.Find(SlotTag))
+	{
+		return SlotData->Actions;
+	}
+	return EmptySlot;
+}
+
 int32 URogueliteSubsystem::GetSlotCount(FGameplayTag SlotTag) const
 {
 	if (const FRogueliteSlotArray* SlotData = RunState.Slots.Find(SlotTag))
@@ -692,6 +1382,8 @@ bool URogueliteSubsystem::IsSlotFull(FGameplayTag SlotTag, int32 MaxCount) const
 
 FRogueliteRunSaveData URogueliteSubsystem::CreateRunSaveData() const
 {
+	ROGUELITE_SCOPE_CYCLE_COUNTER(STAT_RogueliteCreateRunSaveData);
+
 	FRogueliteRunSaveData SaveData;
 
 	for (const auto& Pair : RunState.AcquiredActions)
@@ -716,15 +1408,25 @@ FRogueliteRunSaveData URogueliteSubsystem::CreateRunSaveData() const
 	}
 
 	SaveData.ActiveTags = RunState.ActiveTags;
+	SaveData.SystemTagCounts = RunState.SystemTagCounts;
 	SaveData.NumericData = RunState.NumericData;
+	SaveData.RandomSeed = RunState.RandomSeed;
+
+	for (const auto& StreamPair : RunState.RandomStreams)
+	{
+		SaveData.RandomStreamStates.Add(StreamPair.Key, StreamPair.Value.GetCurrentSeed());
+	}
 
 	return SaveData;
 }
 
 void URogueliteSubsystem::RestoreRunFromSaveData(const FRogueliteRunSaveData& SaveData)
 {
+	ROGUELITE_SCOPE_CYCLE_COUNTER(STAT_RogueliteRestoreRunFromSaveData);
+
 	RunState.Reset();
 	RunState.bActive = true;
+	++RunStartCount;
 
 	for (const auto& Pair : SaveData.AcquiredActions)
 	{
@@ -732,9 +1434,7 @@ void URogueliteSubsystem::RestoreRunFromSaveData(const FRogueliteRunSaveData& Sa
 		{
 			if (URogueliteActionData* Action = Cast<URogueliteActionData>(Obj))
 			{
-				FRogueliteAcquiredInfo Info;
-				Info.Stacks = Pair.Value;
-				RunState.AcquiredActions.Add(Action, Info);
+				RunState.SetStacks(Action, Pair.Value);
 			}
 		}
 	}
@@ -755,7 +1455,129 @@ void URogueliteSubsystem::RestoreRunFromSaveData(const FRogueliteRunSaveData& Sa
 	}
 
 	RunState.ActiveTags = SaveData.ActiveTags;
+	RunState.SystemTagCounts = SaveData.SystemTagCounts;
 	RunState.NumericData = SaveData.NumericData;
+	RunState.RandomSeed = SaveData.RandomSeed != 0 ? SaveData.RandomSeed : GenerateRunSeed();
+
+	// 저장 시점의 스트림 상태에서 이어서 뽑도록 복원
+	for (const auto& StreamPair : SaveData.RandomStreamStates)
+	{
+		RunState.RandomStreams.Add(StreamPair.Key, FRandomStream(StreamPair.Value));
+	}
+
+	if (ReplayLog.IsOpen())
+	{
+		FRogueliteReplayEvent Event;
+		Event.Type = ERogueliteReplayEventType::Restore;
+		FRogueliteRunSaveData PayloadData = SaveData;
+		FMemoryWriter PayloadWriter(Event.Payload);
+		SerializeSaveDataPayload(PayloadWriter, PayloadData);
+		ReplayLog.Append(Event);
+	}
+
+	MarkRunStateDirty();
+}
+
+/*~ Replay ~*/
+
+bool URogueliteSubsystem::ReplayRunFromLog(const FString& FilePath, FString& OutFailReason)
+{
+	int32 LoggedSeed = 0;
+	TArray<FRogueliteReplayEvent> Events;
+	if (!FRogueliteReplayLog::LoadFromFile(FilePath, LoggedSeed, Events))
+	{
+		OutFailReason = TEXT("Failed to read replay log");
+		return false;
+	}
+
+	{
+		TGuardValue<bool> ReplayGuard(bReplaying, true);
+		StartRun(LoggedSeed);
+
+		for (int32 EventIndex = 0; EventIndex < Events.Num(); ++EventIndex)
+		{
+			const FRogueliteReplayEvent& Event = Events[EventIndex];
+
+			URogueliteActionData* Action = nullptr;
+			if (Event.Type != ERogueliteReplayEventType::Query && Event.Type != ERogueliteReplayEventType::DrawPool && Event.ActionPaths.Num() > 0)
+			{
+				Action = Cast<URogueliteActionData>(Event.ActionPaths[0].TryLoad());
+			}
+
+			bool bApplied = true;
+			switch (Event.Type)
+			{
+			case ERogueliteReplayEventType::Query:
+			case ERogueliteReplayEventType::DrawPool:
+				{
+					// 쿼리 입력은 앞선 이벤트로 이미 동일하므로 스트림 상태만 맞춰 빨리 감기
+					FRandomStream& Stream = RunState.GetRandomStream(Event.Tag);
+					bApplied = Stream.GetCurrentSeed() == Event.StreamStateBefore;
+					Stream.Initialize(Event.StreamStateAfter);
+					++RunStateVersion;
+					break;
+				}
+			case ERogueliteReplayEventType::Acquire:
+				{
+					FString AcquireFailReason;
+					bApplied = TryAcquireAction(Action, AcquireFailReason, Event.Stacks);
+					break;
+				}
+			case ERogueliteReplayEventType::Remove:
+				bApplied = RemoveAction(Action, Event.Stacks, Event.bRemoveAll);
+				break;
+			case ERogueliteReplayEventType::Equip:
+				bApplied = EquipActionToSlot(Action, Event.Tag);
+				break;
+			case ERogueliteReplayEventType::Unequip:
+				UnequipActionFromSlot(Action, Event.Tag);
+				break;
+			case ERogueliteReplayEventType::SetValue:
+				SetRunStateValue(Event.Tag, Event.Value);
+				break;
+			case ERogueliteReplayEventType::AddTag:
+				AddTagToSystem(Event.Tag);
+				break;
+			case ERogueliteReplayEventType::RemoveTag:
+				RemoveTagFromSystem(Event.Tag);
+				break;
+			case ERogueliteReplayEventType::Restore:
+				{
+					FRogueliteRunSaveData SaveData;
+					FMemoryReader PayloadReader(Event.Payload);
+					SerializeSaveDataPayload(PayloadReader, SaveData);
+					bApplied = !PayloadReader.IsError();
+					if (bApplied)
+					{
+						RestoreRunFromSaveData(SaveData);
+					}
+					break;
+				}
+			}
+
+			if (!bApplied)
+			{
+				// 반쯤 재현된 런이 남지 않도록 종료
+				EndRun(false);
+				OutFailReason = FString::Printf(TEXT("Replay desync at event %d"), EventIndex);
+				return false;
+			}
+		}
+	}
+
+	// 재현한 지점부터 같은 로그에 이어서 기록
+	const URogueliteSettings* Settings = URogueliteSettings::Get();
+	if (IsValid(Settings) && Settings->bEnableReplayLog)
+	{
+		ReplayLog.Resume(FilePath);
+	}
+
+	return true;
+}
+
+FString URogueliteSubsystem::GetReplayLogPath() const
+{
+	return ReplayLog.GetFilePath();
 }
 
 /*~ Pre-Acquire Check ~*/
@@ -774,6 +1596,8 @@ void URogueliteSubsystem::UnregisterPreAcquireCheck(FRoguelitePreAcquireCheckSig
 
 void URogueliteSubsystem::ApplyAutoEffects(URogueliteActionData* Action, int32 Stacks)
 {
+	ROGUELITE_SCOPE_CYCLE_COUNTER(STAT_RogueliteApplyAutoEffects);
+
 	if (!IsValid(Action))
 	{
 		return;
@@ -789,20 +1613,27 @@ void URogueliteSubsystem::ApplyAutoEffects(URogueliteActionData* Action, int32 S
 				float NewValue = RunState.ApplyValue(Entry.Key, Entry.Value, Entry.ApplyMode);
 				if (!FMath::IsNearlyEqual(OldValue, NewValue))
 				{
+					MarkChanged(ERogueliteChangeCategory::Numeric);
 					OnRunStateValueChanged.Broadcast(Entry.Key, OldValue, NewValue);
 				}
 			}
 		}
 	}
 
-	if (Action->bAutoGrantTags)
+	// 처음 획득했을 때만 액션당 한 번 참조 추가
+	if (Action->bAutoGrantTags && RunState.GetStacks(Action) == Stacks)
 	{
-		RunState.ActiveTags.AppendTags(Action->ActionTags);
+		for (const FGameplayTag& Tag : Action->ActionTags)
+		{
+			AddTagRef(Tag);
+		}
 	}
 }
 
 void URogueliteSubsystem::RemoveAutoEffects(URogueliteActionData* Action, int32 Stacks)
 {
+	ROGUELITE_SCOPE_CYCLE_COUNTER(STAT_RogueliteRemoveAutoEffects);
+
 	if (!IsValid(Action))
 	{
 		return;
@@ -831,11 +1662,19 @@ void URogueliteSubsystem::RemoveAutoEffects(URogueliteActionData* Action, int32
 
 				if (!FMath::IsNearlyEqual(OldValue, NewValue))
 				{
+					MarkChanged(ERogueliteChangeCategory::Numeric);
 					OnRunStateValueChanged.Broadcast(Entry.Key, OldValue, NewValue);
 				}
 			}
 		}
 	}
 
-	// 태그 제거는 다른 액션이 같은 태그를 부여했을 수 있어 처리 안 함
+	// 완전히 제거될 때만 참조 해제 (다른 액션이 부여한 태그는 유지)
+	if (Action->bAutoGrantTags && RunState.GetStacks(Action) == Stacks)
+	{
+		for (const FGameplayTag& Tag : Action->ActionTags)
+		{
+			RemoveTagRef(Tag);
+		}
+	}
 }
@@ -0,0 +1,169 @@
+#include "RogueliteTypes.h"
+#include "RogueliteActionData.h"
+
+/*~ FRogueliteRunState ~*/
+
+void FRogueliteRunState::SetStacks(URogueliteActionData* Action, int32 NewStacks)
+{
+	if (Action == nullptr)
+	{
+		return;
+	}
+
+	NewStacks = FMath::Max(NewStacks, 0);
+	const int32 OldStacks = GetStacks(Action);
+	if (OldStacks == NewStacks)
+	{
+		return;
+	}
+
+	// HasTag와 같은 의미가 되도록 부모 태그까지 인덱싱
+	const FGameplayTagContainer IndexTags = Action->ActionTags.GetGameplayTagParents();
+
+	if (NewStacks == 0)
+	{
+		AcquiredActions.Remove(Action);
+
+		for (const FGameplayTag& Tag : IndexTags)
+		{
+			if (TArray<URogueliteActionData*>* Actions = AcquiredTagIndex.Find(Tag))
+			{
+				Actions->Remove(Action);
+				if (Actions->Num() == 0)
+				{
+					AcquiredTagIndex.Remove(Tag);
+				}
+			}
+		}
+	}
+	else
+	{
+		AcquiredActions.FindOrAdd(Action).Stacks = NewStacks;
+
+		if (OldStacks == 0)
+		{
+			for (const FGameplayTag& Tag : IndexTags)
+			{
+				AcquiredTagIndex.FindOrAdd(Tag).Add(Action);
+			}
+		}
+	}
+
+	const int32 StackDelta = NewStacks - OldStacks;
+	for (const FGameplayTag& Tag : IndexTags)
+	{
+		int32& TagStacks = AcquiredTagStacks.FindOrAdd(Tag);
+		TagStacks += StackDelta;
+		if (TagStacks <= 0)
+		{
+			AcquiredTagStacks.Remove(Tag);
+		}
+	}
+}
+
+void FRogueliteRunState::RebuildAcquiredTagIndex()
+{
+	AcquiredTagIndex.Reset();
+	AcquiredTagStacks.Reset();
+
+	for (const auto& Pair : AcquiredActions)
+	{
+		if (Pair.Key == nullptr || Pair.Value.Stacks <= 0)
+		{
+			continue;
+		}
+
+		for (const FGameplayTag& Tag : Pair.Key->ActionTags.GetGameplayTagParents())
+		{
+			AcquiredTagIndex.FindOrAdd(Tag).Add(Pair.Key);
+			AcquiredTagStacks.FindOrAdd(Tag) += Pair.Value.Stacks;
+		}
+	}
+}
+
+const TArray<URogueliteActionData*>& FRogueliteRunState::GetAcquiredWithTag(FGameplayTag Tag) const
+{
+	static const TArray<URogueliteActionData*> EmptyActions;
+
+	if (const TArray<URogueliteActionData*>* Actions = AcquiredTagIndex.Find(Tag))
+	{
+		return *Actions;
+	}
+	return EmptyActions;
+}
+
+bool FRogueliteRunState::AddTagRef(FGameplayTag Tag)
+{
+	if (!Tag.IsValid())
+	{
+		return false;
+	}
+
+	int32& Count = TagRefCounts.FindOrAdd(Tag);
+	++Count;
+	if (Count == 1)
+	{
+		ActiveTags.AddTag(Tag);
+		return true;
+	}
+	return false;
+}
+
+bool FRogueliteRunState::RemoveTagRef(FGameplayTag Tag)
+{
+	int32* Count = TagRefCounts.Find(Tag);
+	if (Count == nullptr)
+	{
+		return false;
+	}
+
+	--(*Count);
+	if (*Count <= 0)
+	{
+		TagRefCounts.Remove(Tag);
+		ActiveTags.RemoveTag(Tag);
+		return true;
+	}
+	return false;
+}
+
+void FRogueliteRunState::RecomputeTagRefCounts()
+{
+	// ActiveTags에서 직접 빠진 태그의 시스템 부여분은 폐기
+	for (auto It = SystemTagCounts.CreateIterator(); It; ++It)
+	{
+		if (It.Value() <= 0 || !ActiveTags.HasTagExact(It.Key()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TagRefCounts = SystemTagCounts;
+
+	// 자동 부여 액션은 스택과 무관하게 액션당 한 번
+	for (const auto& Pair : AcquiredActions)
+	{
+		if (Pair.Key != nullptr && Pair.Key->bAutoGrantTags && Pair.Value.Stacks > 0)
+		{
+			for (const FGameplayTag& Tag : Pair.Key->ActionTags)
+			{
+				++TagRefCounts.FindOrAdd(Tag);
+			}
+		}
+	}
+
+	for (const FGameplayTag& Tag : ActiveTags)
+	{
+		if (!TagRefCounts.Contains(Tag))
+		{
+			SystemTagCounts.Add(Tag, 1);
+			TagRefCounts.Add(Tag, 1);
+		}
+	}
+
+	ActiveTags.Reset();
+	for (const auto& Pair : TagRefCounts)
+	{
+		ActiveTags.AddTag(Pair.Key);
+	}
+}
@@ -0,0 +1,210 @@
+#include "RogueliteWeightedPool.h"
+#include "Algo/BinarySearch.h"
+
+namespace
+{
+	// 누적값이 Random보다 큰 첫 항목 (가중치 0인 항목은 누적값이 앞 항목과 같아 Random == 0이어도 선택되지 않음)
+	int32 FindCumulativeIndex(const TArray<float>& Cumulative, float Random)
+	{
+		const int32 Index = Algo::UpperBound(Cumulative, Random);
+
+		// 부동소수 반올림으로 Random이 합계와 같아지면 마지막 양수 가중치 항목
+		return Index < Cumulative.Num() ? Index : Algo::LowerBound(Cumulative, Cumulative.Last());
+	}
+}
+
+void FRogueliteWeightedPool::Build()
+{
+	TArray<float> NewWeights;
+	NewWeights.Reserve(Entries.Num());
+
+	for (const FRogueliteWeightedEntry& Entry : Entries)
+	{
+		NewWeights.Add(ApplyWeightModifiers(Entry.Weight, Entry.Tags, WeightModifiers));
+	}
+
+	BuildFromWeights(MoveTemp(NewWeights));
+}
+
+void FRogueliteWeightedPool::BuildFromWeights(TArray<float>&& InWeights)
+{
+	Weights = MoveTemp(InWeights);
+	BuildCumulative();
+}
+
+void FRogueliteWeightedPool::BuildFromWeights(TConstArrayView<float> InWeights)
+{
+	Weights.Reset();
+	Weights.Append(InWeights.GetData(), InWeights.Num());
+	BuildCumulative();
+}
+
+void FRogueliteWeightedPool::BuildCumulative()
+{
+	Cumulative.SetNumUninitialized(Weights.Num(), EAllowShrinking::No);
+
+	float Total = 0.f;
+	for (int32 i = 0; i < Weights.Num(); ++i)
+	{
+		Weights[i] = FMath::Max(Weights[i], 0.f);
+		Total += Weights[i];
+		Cumulative[i] = Total;
+	}
+}
+
+int32 FRogueliteWeightedPool::Draw(FRandomStream& RandomStream) const
+{
+	const int32 NumEntries = Cumulative.Num();
+	if (NumEntries == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const float Total = Cumulative.Last();
+	if (Total <= 0.f)
+	{
+		return RandomStream.RandRange(0, NumEntries - 1);
+	}
+
+	return FindCumulativeIndex(Cumulative, RandomStream.FRandRange(0.f, Total));
+}
+
+void FRogueliteWeightedPool::DrawMany(FRandomStream& RandomStream, int32 Count, TArray<int32>& OutIndices) const
+{
+	OutIndices.Reset();
+	if (Count <= 0 || Cumulative.Num() == 0)
+	{
+		return;
+	}
+
+	OutIndices.SetNumUninitialized(Count, EAllowShrinking::No);
+	DrawMany(RandomStream, MakeArrayView(OutIndices));
+}
+
+int32 FRogueliteWeightedPool::DrawMany(FRandomStream& RandomStream, TArrayView<int32> OutIndices) const
+{
+	if (Cumulative.Num() == 0)
+	{
+		return 0;
+	}
+
+	for (int32& Index : OutIndices)
+	{
+		Index = Draw(RandomStream);
+	}
+	return OutIndices.Num();
+}
+
+void FRogueliteWeightedPool::DrawUnique(FRandomStream& RandomStream, int32 Count, TArray<int32>& OutIndices, FRogueliteWeightedDrawScratch* Scratch) const
+{
+	OutIndices.Reset();
+	if (Count <= 0 || Weights.Num() == 0)
+	{
+		return;
+	}
+
+	OutIndices.SetNumUninitialized(FMath::Min(Count, Weights.Num()), EAllowShrinking::No);
+	DrawUnique(RandomStream, MakeArrayView(OutIndices), Scratch);
+}
+
+int32 FRogueliteWeightedPool::DrawUnique(FRandomStream& RandomStream, TArrayView<int32> OutIndices, FRogueliteWeightedDrawScratch* Scratch) const
+{
+	const int32 NumEntries = Weights.Num();
+	const int32 Count = FMath::Min(OutIndices.Num(), NumEntries);
+	if (Count <= 0)
+	{
+		return 0;
+	}
+
+	FRogueliteWeightedDrawScratch LocalScratch;
+	FRogueliteWeightedDrawScratch& DrawScratch = Scratch ? *Scratch : LocalScratch;
+	TArray<int32>& Remaining = DrawScratch.Remaining;
+	TArray<float>& RemainingCumulative = DrawScratch.RemainingCumulative;
+	Remaining.SetNumUninitialized(NumEntries, EAllowShrinking::No);
+	for (int32 i = 0; i < NumEntries; ++i)
+	{
+		Remaining[i] = i;
+	}
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		// 남은 항목 기준 누적 테이블 (선택된 항목 제외)
+		RemainingCumulative.Reset();
+		float Total = 0.f;
+		for (int32 Idx : Remaining)
+		{
+			Total += Weights[Idx];
+			RemainingCumulative.Add(Total);
+		}
+
+		int32 Picked = 0;
+		if (Total <= 0.f)
+		{
+			// 모든 가중치가 0이면 균등 확률
+			Picked = RandomStream.RandRange(0, Remaining.Num() - 1);
+		}
+		else
+		{
+			Picked = FindCumulativeIndex(RemainingCumulative, RandomStream.FRandRange(0.f, Total));
+		}
+
+		OutIndices[i] = Remaining[Picked];
+		Remaining.RemoveAt(Picked, 1, EAllowShrinking::No);
+	}
+	return Count;
+}
+
+float FRogueliteWeightedPool::ApplyWeightModifiers(float Weight, const FGameplayTagContainer& Tags, const TMap<FGameplayTag, float>& Modifiers)
+{
+	for (const TPair<FGameplayTag, float>& Modifier : Modifiers)
+	{
+		if (Tags.HasTag(Modifier.Key))
+		{
+			Weight *= Modifier.Value;
+		}
+	}
+	return FMath::Max(Weight, 0.f);
+}
+
+uint32 FRogueliteWeightedPool::GetContentHash() const
+{
+	uint32 Hash = GetTypeHash(Entries.Num());
+	for (const FRogueliteWeightedEntry& Entry : Entries)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Entry.Weight));
+		for (const FGameplayTag& Tag : Entry.Tags)
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Tag));
+		}
+	}
+
+	// TMap 순회 순서에 무관하도록 배율은 합산
+	uint32 ModifierHash = 0;
+	for (const TPair<FGameplayTag, float>& Modifier : WeightModifiers)
+	{
+		ModifierHash += HashCombine(GetTypeHash(Modifier.Key), GetTypeHash(Modifier.Value));
+	}
+	return HashCombine(Hash, ModifierHash);
+}
+
+bool FRogueliteWeightedPool::HasSameContent(const FRogueliteWeightedPool& Other) const
+{
+	if (Entries.Num() != Other.Entries.Num() || !WeightModifiers.OrderIndependentCompareEqual(Other.WeightModifiers))
+	{
+		return false;
+	}
+
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		if (Entries[i].Weight != Other.Entries[i].Weight || Entries[i].Tags != Other.Entries[i].Tags)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+SIZE_T FRogueliteWeightedPool::GetAllocatedSize() const
+{
+	return Weights.GetAllocatedSize() + Cumulative.GetAllocatedSize();
+}
@@ -0,0 +1,74 @@
+#include "RogueliteTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && !UE_BUILD_SHIPPING
+
+#include "RogueliteBenchmark.h"
+
+namespace
+{
+	// 회귀 판정 카탈로그 크기
+	constexpr int32 RegressionCatalogSize = 1000;
+
+	// 연산별 평균 시간 상한 (us/op). 개발 PC 측정치의 약 10배로 느린 CI 머신에서도 흔들리지 않게 잡음
+	struct FBudget
+	{
+		const TCHAR* Operation;
+		double MaxAverageUs;
+	};
+
+	constexpr FBudget Budgets[] =
+	{
+		{ TEXT("RegisterAction"), 50.0 },
+		{ TEXT("ExecuteQuery"), 200.0 },
+		{ TEXT("ExecuteQueryInto"), 200.0 },
+		{ TEXT("DrawUnique"), 50.0 },
+		{ TEXT("DrawMany"), 20.0 },
+		{ TEXT("TryAcquireAction"), 100.0 },
+		{ TEXT("CreateRunSaveData"), 5000.0 },
+		{ TEXT("RestoreRunFromSaveData"), 10000.0 },
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteBenchmarkRegressionTest, "Roguelite.Benchmark.Regression", ROGUELITE_PERF_TEST_FLAGS)
+
+bool FRogueliteBenchmarkRegressionTest::RunTest(const FString& Parameters)
+{
+	const TArray<FGameplayTag> PoolTags = { TAG_RogueliteTest_Pool_A, TAG_RogueliteTest_Pool_B };
+	const TArray<FGameplayTag> OtherTags = { TAG_RogueliteTest_Kind_Fire, TAG_RogueliteTest_Kind_Ice, TAG_RogueliteTest_Stat_Attack };
+
+	TArray<RogueliteBenchmark::FResult> Results;
+	RogueliteBenchmark::RunCatalog(RegressionCatalogSize, PoolTags, OtherTags, Results);
+
+	for (const FBudget& Budget : Budgets)
+	{
+		const RogueliteBenchmark::FResult* Result = RogueliteBenchmark::FindResult(Results, RegressionCatalogSize, Budget.Operation);
+		if (!TestNotNull(FString::Printf(TEXT("%s measured"), Budget.Operation), Result))
+		{
+			continue;
+		}
+
+		AddInfo(FString::Printf(TEXT("%s: %.3fus/op, %lld allocs"), Budget.Operation, Result->GetAverageUs(), Result->Allocations));
+		TestTrue(FString::Printf(TEXT("%s within %.0fus/op (%.3f)"), Budget.Operation, Budget.MaxAverageUs, Result->GetAverageUs()), Result->GetAverageUs() <= Budget.MaxAverageUs);
+	}
+
+	// 워밍업 이후 쿼리 임시 버퍼는 커지지 않음
+	for (const TCHAR* Operation : { TEXT("ExecuteQuery"), TEXT("ExecuteQueryInto") })
+	{
+		if (const RogueliteBenchmark::FResult* Result = RogueliteBenchmark::FindResult(Results, RegressionCatalogSize, Operation))
+		{
+			TestEqual(FString::Printf(TEXT("%s scratch growth"), Operation), Result->ScratchGrowth, 0);
+		}
+	}
+
+	// 재사용 버퍼로 추첨하면 할당 없음
+	for (const TCHAR* Operation : { TEXT("DrawUnique"), TEXT("DrawMany") })
+	{
+		if (const RogueliteBenchmark::FResult* Result = RogueliteBenchmark::FindResult(Results, RegressionCatalogSize, Operation))
+		{
+			TestEqual(FString::Printf(TEXT("%s allocations"), Operation), Result->Allocations, static_cast<int64>(0));
+		}
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,122 @@
+#include "RogueliteTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "RogueliteSubsystem.h"
+#include "RogueliteActionData.h"
+#include "RogueliteQueryFilter.h"
+#include "RogueliteQueryReport.h"
+
+using namespace RogueliteTests;
+
+namespace
+{
+	// Pool_A 풀에 Kind 태그가 붙은 액션 등록
+	URogueliteActionData* AddPoolAction(FTestInstance& Instance, FGameplayTag KindTag)
+	{
+		URogueliteActionData* Action = Instance.MakeAction(TAG_RogueliteTest_Pool_A);
+		Action->ActionTags.AddTag(KindTag);
+		Instance.GetSubsystem()->RegisterAction(Action);
+		return Action;
+	}
+
+	const FRogueliteQueryStageReport& GetStage(const FRogueliteQueryReport& Report, ERogueliteQueryStage Stage)
+	{
+		return Report.Stages[static_cast<int32>(Stage)];
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteExplainStageTest, "Roguelite.Explain.StageRejections", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteExplainStageTest::RunTest(const FString& Parameters)
+{
+	FTestInstance Instance;
+	URogueliteSubsystem* Subsystem = Instance.GetSubsystem();
+	AddPoolAction(Instance, TAG_RogueliteTest_Kind_Fire);
+	AddPoolAction(Instance, TAG_RogueliteTest_Kind_Fire);
+	AddPoolAction(Instance, TAG_RogueliteTest_Kind_Ice);
+	Subsystem->StartRun(1);
+
+	FRogueliteQuery Query;
+	Query.PoolTags.AddTag(TAG_RogueliteTest_Pool_A);
+	Query.ExcludeTags.AddTag(TAG_RogueliteTest_Kind_Ice);
+	Query.Count = 1;
+
+	FRogueliteQueryReport Report;
+	const TArray<URogueliteActionData*> Results = Subsystem->ExecuteQueryWithReport(Query, Report);
+
+	TestEqual(TEXT("Candidates"), Report.NumCandidates, 3);
+	TestEqual(TEXT("Passed"), Report.NumPassed, 2);
+	TestEqual(TEXT("Selected"), Report.NumSelected, Results.Num());
+	TestEqual(TEXT("Selected count"), Report.NumSelected, 1);
+	TestEqual(TEXT("Require evaluated"), GetStage(Report, ERogueliteQueryStage::RequireTags).Evaluated, 3);
+	TestEqual(TEXT("Exclude rejected"), GetStage(Report, ERogueliteQueryStage::ExcludeTags).Rejected, 1);
+	TestEqual(TEXT("Mode reached by survivors"), GetStage(Report, ERogueliteQueryStage::Mode).Evaluated, 2);
+	TestFalse(TEXT("Pool name"), Report.PoolName.IsEmpty());
+
+	// explain 없는 쿼리는 마지막 리포트를 덮어쓰지 않음
+	Query.ExcludeTags.Reset();
+	Subsystem->ExecuteQuery(Query);
+	TestEqual(TEXT("Report kept"), Subsystem->GetLastQueryReport().NumPassed, 2);
+
+	Subsystem->EndRun(false);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteExplainFilterTreeTest, "Roguelite.Explain.FilterTreeNodes", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteExplainFilterTreeTest::RunTest(const FString& Parameters)
+{
+	FTestInstance Instance;
+	URogueliteSubsystem* Subsystem = Instance.GetSubsystem();
+	URogueliteActionData* Owned = AddPoolAction(Instance, TAG_RogueliteTest_Kind_Fire);
+	AddPoolAction(Instance, TAG_RogueliteTest_Kind_Fire);
+	AddPoolAction(Instance, TAG_RogueliteTest_Kind_Ice);
+	Subsystem->StartRun(1);
+	Subsystem->AcquireAction(Owned);
+
+	// And(HasTags(Fire), Not(IsAcquired))
+	URogueliteFilter_HasTags* HasFire = NewObject<URogueliteFilter_HasTags>();
+	HasFire->RequiredTags.AddTag(TAG_RogueliteTest_Kind_Fire);
+	URogueliteFilter_Not* NotAcquired = NewObject<URogueliteFilter_Not>();
+	NotAcquired->SubFilter = NewObject<URogueliteFilter_IsAcquired>();
+	URogueliteFilter_And* Root = NewObject<URogueliteFilter_And>();
+	Root->SubFilters = { HasFire, NotAcquired };
+
+	FRogueliteQuery Query;
+	Query.PoolTags.AddTag(TAG_RogueliteTest_Pool_A);
+	Query.CustomFilter = Root;
+	Query.Count = 3;
+
+	FRogueliteQueryReport Report;
+	Subsystem->ExecuteQueryWithReport(Query, Report);
+
+	TestEqual(TEXT("Only the unowned fire action passes"), Report.NumPassed, 1);
+	TestEqual(TEXT("Custom filter rejections"), GetStage(Report, ERogueliteQueryStage::CustomFilter).Rejected, 2);
+	if (!TestEqual(TEXT("Node count"), Report.FilterNodes.Num(), 4))
+	{
+		return false;
+	}
+
+	// 처음 평가된 순서: And → HasTags → Not → IsAcquired
+	const FRogueliteFilterNodeReport& RootNode = Report.FilterNodes[0];
+	const FRogueliteFilterNodeReport& HasNode = Report.FilterNodes[1];
+	const FRogueliteFilterNodeReport& NotNode = Report.FilterNodes[2];
+	const FRogueliteFilterNodeReport& AcquiredNode = Report.FilterNodes[3];
+	TestEqual(TEXT("Root depth"), RootNode.Depth, 0);
+	TestEqual(TEXT("Child depth"), HasNode.Depth, 1);
+	TestEqual(TEXT("Not depth"), NotNode.Depth, 1);
+	TestEqual(TEXT("Grandchild depth"), AcquiredNode.Depth, 2);
+
+	TestEqual(TEXT("Root evaluated"), RootNode.Evaluated, 3);
+	TestEqual(TEXT("Root passed"), RootNode.Passed, 1);
+	TestEqual(TEXT("HasTags passed"), HasNode.Passed, 2);
+	TestEqual(TEXT("Not short-circuited for ice"), NotNode.Evaluated, 2);
+	TestEqual(TEXT("IsAcquired passed"), AcquiredNode.Passed, 1);
+	TestTrue(TEXT("Report text"), Report.ToString().Contains(HasNode.FilterName));
+
+	Subsystem->EndRun(false);
+	return true;
+}
+
+#endif
@@ -0,0 +1,100 @@
+#include "RogueliteTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "RogueliteSubsystem.h"
+#include "RogueliteActionData.h"
+#include "RogueliteQueryFilter.h"
+#include "RogueliteSettings.h"
+#include "RogueliteTestFilter.h"
+#include <atomic>
+
+using namespace RogueliteTests;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteFilterThreadSafeOptInTest, "Roguelite.Filter.ThreadSafeIsOptIn", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteFilterThreadSafeOptInTest::RunTest(const FString& Parameters)
+{
+	URogueliteFilter_HasTags* HasTags = NewObject<URogueliteFilter_HasTags>();
+	URogueliteFilter_NotAcquired* NotAcquired = NewObject<URogueliteFilter_NotAcquired>();
+	URogueliteTestFilter_Callback* Callback = NewObject<URogueliteTestFilter_Callback>();
+
+	// 내장 필터만 opt-in, 재정의하지 않은 네이티브 필터는 기본 false
+	TestTrue(TEXT("Built-in opts in"), HasTags->IsThreadSafe());
+	TestTrue(TEXT("Built-in opts in"), NotAcquired->IsThreadSafe());
+	TestFalse(TEXT("Native filter without opt-in"), Callback->IsThreadSafe());
+
+	// 조합 필터는 하위 필터가 모두 스레드 안전할 때만
+	URogueliteFilter_And* SafeAnd = NewObject<URogueliteFilter_And>();
+	SafeAnd->SubFilters = { HasTags, NotAcquired };
+	TestTrue(TEXT("And of safe filters"), SafeAnd->IsThreadSafe());
+
+	URogueliteFilter_Or* UnsafeOr = NewObject<URogueliteFilter_Or>();
+	UnsafeOr->SubFilters = { HasTags, Callback };
+	TestFalse(TEXT("Or with unsafe child"), UnsafeOr->IsThreadSafe());
+
+	URogueliteFilter_Not* UnsafeNot = NewObject<URogueliteFilter_Not>();
+	UnsafeNot->SubFilter = UnsafeOr;
+	TestFalse(TEXT("Not of unsafe subtree"), UnsafeNot->IsThreadSafe());
+
+	URogueliteFilter_Not* EmptyNot = NewObject<URogueliteFilter_Not>();
+	TestTrue(TEXT("Empty Not"), EmptyNot->IsThreadSafe());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteFilterParallelGateTest, "Roguelite.Filter.UnsafeFilterRunsOnGameThread", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteFilterParallelGateTest::RunTest(const FString& Parameters)
+{
+	URogueliteSettings* Settings = GetMutableDefault<URogueliteSettings>();
+	TGuardValue<bool> ParallelGuard(Settings->bParallelQueryFiltering, true);
+	TGuardValue<int32> ThresholdGuard(Settings->ParallelFilterThreshold, 1);
+	TGuardValue<int32> BatchGuard(Settings->ParallelFilterBatchSize, 1);
+
+	FTestInstance Instance;
+	URogueliteSubsystem* Subsystem = Instance.GetSubsystem();
+	for (int32 i = 0; i < 64; ++i)
+	{
+		URogueliteActionData* Action = Instance.MakeAction(TAG_RogueliteTest_Pool_A, 1.f + i);
+		Action->ActionTags.AddTag(i % 3 == 0 ? TAG_RogueliteTest_Kind_Fire : TAG_RogueliteTest_Kind_Ice);
+		Subsystem->RegisterAction(Action);
+	}
+	Subsystem->StartRun(6);
+
+	// opt-in하지 않은 필터는 병렬 설정이어도 게임 스레드에서만 평가
+	std::atomic<bool> bAllOnGameThread = true;
+	URogueliteTestFilter_Callback* Callback = NewObject<URogueliteTestFilter_Callback>();
+	Callback->Callback = [&bAllOnGameThread](URogueliteActionData* Action)
+	{
+		if (!IsInGameThread())
+		{
+			bAllOnGameThread = false;
+		}
+		return Action->ActionTags.HasTagExact(TAG_RogueliteTest_Kind_Fire);
+	};
+
+	FRogueliteQuery Query;
+	Query.PoolTags.AddTag(TAG_RogueliteTest_Pool_A);
+	Query.Count = 5;
+	Query.RandomSeed = 21;
+	Query.CustomFilter = Callback;
+	const TArray<URogueliteActionData*> UnsafeResults = Subsystem->ExecuteQuery(Query);
+	TestTrue(TEXT("Unsafe filter stayed on game thread"), bAllOnGameThread.load());
+	TestEqual(TEXT("Unsafe filter results"), UnsafeResults.Num(), 5);
+
+	// 스레드 안전 필터는 병렬 경로에서도 직렬과 같은 결과
+	URogueliteFilter_HasTags* HasFire = NewObject<URogueliteFilter_HasTags>();
+	HasFire->RequiredTags.AddTag(TAG_RogueliteTest_Kind_Fire);
+	Query.CustomFilter = HasFire;
+	const TArray<URogueliteActionData*> ParallelResults = Subsystem->ExecuteQuery(Query);
+	{
+		TGuardValue<bool> SerialGuard(Settings->bParallelQueryFiltering, false);
+		TestEqual(TEXT("Parallel matches serial"), ParallelResults, Subsystem->ExecuteQuery(Query));
+	}
+	TestEqual(TEXT("Same selection as unsafe path"), ParallelResults, UnsafeResults);
+
+	Subsystem->EndRun(false);
+	return true;
+}
+
+#endif
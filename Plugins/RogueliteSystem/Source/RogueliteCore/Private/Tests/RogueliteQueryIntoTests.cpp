@@ -0,0 +1,131 @@
+#include "RogueliteTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "RogueliteSubsystem.h"
+#include "RogueliteActionData.h"
+#include "RogueliteWeightedPool.h"
+
+using namespace RogueliteTests;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteQueryIntoViewTest, "Roguelite.Query.IntoView", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteQueryIntoViewTest::RunTest(const FString& Parameters)
+{
+	FTestInstance Instance;
+	URogueliteSubsystem* Subsystem = Instance.GetSubsystem();
+	for (int32 i = 0; i < 6; ++i)
+	{
+		Instance.AddAction(TAG_RogueliteTest_Pool_A, 1.f + i);
+	}
+	Subsystem->StartRun(2);
+
+	FRogueliteQuery Query;
+	Query.PoolTags.AddTag(TAG_RogueliteTest_Pool_A);
+	Query.Count = 4;
+	Query.RandomSeed = 17;
+
+	// 같은 시드의 배열 반환 결과와 일치
+	const TArray<URogueliteActionData*> Expected = Subsystem->ExecuteQuery(Query);
+
+	int32 NumNotified = INDEX_NONE;
+	const FDelegateHandle Handle = Subsystem->OnQueryCompleteNative.AddLambda([&NumNotified](const FRogueliteQuery&, TConstArrayView<URogueliteActionData*> Results)
+	{
+		NumNotified = Results.Num();
+	});
+
+	URogueliteActionData* Buffer[4] = {};
+	const int32 NumWritten = Subsystem->ExecuteQueryInto(Query, MakeArrayView(Buffer));
+	TestEqual(TEXT("Written"), NumWritten, 4);
+	TestEqual(TEXT("Native listener sees written results"), NumNotified, 4);
+	for (int32 i = 0; i < NumWritten; ++i)
+	{
+		TestEqual(TEXT("Matches ExecuteQuery"), Buffer[i], Expected[i]);
+	}
+
+	// 작은 버퍼는 앞에서부터 잘라서 기록하고 나머지는 건드리지 않음
+	URogueliteActionData* SmallBuffer[3] = {};
+	const int32 NumTruncated = Subsystem->ExecuteQueryInto(Query, MakeArrayView(SmallBuffer, 2));
+	TestEqual(TEXT("Truncated count"), NumTruncated, 2);
+	TestEqual(TEXT("Truncated notify"), NumNotified, 2);
+	TestEqual(TEXT("Truncated first"), SmallBuffer[0], Expected[0]);
+	TestEqual(TEXT("Truncated second"), SmallBuffer[1], Expected[1]);
+	TestNull(TEXT("Past the view untouched"), SmallBuffer[2]);
+
+	// 빈 버퍼
+	TestEqual(TEXT("Empty view"), Subsystem->ExecuteQueryInto(Query, TArrayView<URogueliteActionData*>()), 0);
+
+	Subsystem->OnQueryCompleteNative.Remove(Handle);
+	Subsystem->EndRun(false);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteQueryIntoInlineArrayTest, "Roguelite.Query.IntoInlineArray", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteQueryIntoInlineArrayTest::RunTest(const FString& Parameters)
+{
+	FTestInstance Instance;
+	URogueliteSubsystem* Subsystem = Instance.GetSubsystem();
+	for (int32 i = 0; i < 5; ++i)
+	{
+		Instance.AddAction(TAG_RogueliteTest_Pool_B);
+	}
+	Subsystem->StartRun(3);
+
+	FRogueliteQuery Query;
+	Query.PoolTags.AddTag(TAG_RogueliteTest_Pool_B);
+	Query.Count = 3;
+	Query.RandomSeed = 5;
+	const TArray<URogueliteActionData*> Expected = Subsystem->ExecuteQuery(Query);
+
+	// 이전 내용은 지우고 결과 전체를 기록
+	TArray<URogueliteActionData*, TInlineAllocator<4>> Results;
+	Results.Add(nullptr);
+	Subsystem->ExecuteQueryInto(Query, Results);
+	TestEqual(TEXT("Inline result count"), Results.Num(), 3);
+	TestEqual(TEXT("Inline results match"), TArray<URogueliteActionData*>(Results.GetData(), Results.Num()), Expected);
+
+	// 후보보다 많이 요청하면 후보 전체
+	Query.Count = 10;
+	Subsystem->ExecuteQueryInto(Query, Results);
+	TestEqual(TEXT("All candidates"), Results.Num(), 5);
+
+	Subsystem->EndRun(false);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteWeightedPoolViewDrawTest, "Roguelite.WeightedPool.ViewOverloads", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteWeightedPoolViewDrawTest::RunTest(const FString& Parameters)
+{
+	FRogueliteWeightedPool Pool;
+	Pool.BuildFromWeights(TConstArrayView<float>({ 1.f, 0.f, 2.f, 3.f }));
+
+	// 배열 오버로드와 같은 스트림이면 같은 결과
+	FRandomStream ArrayStream(8);
+	FRandomStream ViewStream(8);
+	TArray<int32> FromArray;
+	int32 FromView[6];
+	Pool.DrawMany(ArrayStream, 6, FromArray);
+	TestEqual(TEXT("DrawMany written"), Pool.DrawMany(ViewStream, MakeArrayView(FromView)), 6);
+	TestEqual(TEXT("DrawMany matches"), TArray<int32>(FromView, 6), FromArray);
+	for (int32 Index : FromView)
+	{
+		TestNotEqual(TEXT("Zero weight never drawn"), Index, 1);
+	}
+
+	Pool.DrawUnique(ArrayStream, 3, FromArray);
+	TestEqual(TEXT("DrawUnique written"), Pool.DrawUnique(ViewStream, MakeArrayView(FromView, 3)), 3);
+	TestEqual(TEXT("DrawUnique matches"), TArray<int32>(FromView, 3), FromArray);
+
+	// 항목 수보다 큰 버퍼는 항목 수만큼만 기록
+	TestEqual(TEXT("DrawUnique clamped"), Pool.DrawUnique(ViewStream, MakeArrayView(FromView)), Pool.Num());
+
+	// 빈 풀
+	const FRogueliteWeightedPool Empty;
+	TestEqual(TEXT("Empty DrawMany"), Empty.DrawMany(ViewStream, MakeArrayView(FromView)), 0);
+	TestEqual(TEXT("Empty DrawUnique"), Empty.DrawUnique(ViewStream, MakeArrayView(FromView)), 0);
+	return true;
+}
+
+#endif
@@ -0,0 +1,160 @@
+#include "RogueliteTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "RogueliteSubsystem.h"
+#include "RogueliteActionData.h"
+#include "RogueliteMallocCounter.h"
+#include "RogueliteSettings.h"
+#include "RogueliteTestFilter.h"
+#include "HAL/FileManager.h"
+
+using namespace RogueliteTests;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteQueryReentrantTest, "Roguelite.Query.ReentrantQueryKeepsOuterScratch", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteQueryReentrantTest::RunTest(const FString& Parameters)
+{
+	FTestInstance Instance;
+	URogueliteSubsystem* Subsystem = Instance.GetSubsystem();
+	for (int32 i = 0; i < 4; ++i)
+	{
+		Instance.AddAction(TAG_RogueliteTest_Pool_A);
+		Instance.AddAction(TAG_RogueliteTest_Pool_B);
+	}
+	Subsystem->StartRun(9);
+
+	FRogueliteQuery NestedQuery;
+	NestedQuery.PoolTags.AddTag(TAG_RogueliteTest_Pool_B);
+	NestedQuery.Count = 2;
+
+	// 필터 평가 중에 다른 풀을 쿼리
+	int32 NumNestedQueries = 0;
+	bool bNestedResultsValid = true;
+	URogueliteTestFilter_Callback* Filter = NewObject<URogueliteTestFilter_Callback>();
+	Filter->Callback = [&](URogueliteActionData* Action)
+	{
+		const TArray<URogueliteActionData*> Nested = Subsystem->ExecuteQuery(NestedQuery);
+		++NumNestedQueries;
+		bNestedResultsValid &= Nested.Num() == 2;
+		for (URogueliteActionData* NestedAction : Nested)
+		{
+			bNestedResultsValid &= NestedAction->ActionTags.HasTagExact(TAG_RogueliteTest_Pool_B);
+		}
+		return true;
+	};
+
+	FRogueliteQuery Query;
+	Query.PoolTags.AddTag(TAG_RogueliteTest_Pool_A);
+	Query.CustomFilter = Filter;
+	Query.Count = 3;
+	Query.bExplain = true;
+
+	const TArray<URogueliteActionData*> Results = Subsystem->ExecuteQuery(Query);
+	TestEqual(TEXT("Nested query per candidate"), NumNestedQueries, 4);
+	TestTrue(TEXT("Nested results"), bNestedResultsValid);
+	TestEqual(TEXT("Outer result count"), Results.Num(), 3);
+	for (URogueliteActionData* Action : Results)
+	{
+		TestTrue(TEXT("Outer results stay in outer pool"), Action->ActionTags.HasTagExact(TAG_RogueliteTest_Pool_A));
+	}
+
+	// 바깥 explain 리포트는 안쪽 쿼리에 덮이지 않음
+	TestEqual(TEXT("Outer report candidates"), Subsystem->GetLastQueryReport().NumCandidates, 4);
+	TestEqual(TEXT("Outer report selected"), Subsystem->GetLastQueryReport().NumSelected, 3);
+
+	Subsystem->EndRun(false);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteQueryIntoAllocationTest, "Roguelite.Query.IntoDoesNotAllocate", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteQueryIntoAllocationTest::RunTest(const FString& Parameters)
+{
+	URogueliteSettings* Settings = GetMutableDefault<URogueliteSettings>();
+	TGuardValue<bool> ReplayGuard(Settings->bEnableReplayLog, false);
+	TGuardValue<bool> LoggingGuard(Settings->bEnableDebugLogging, false);
+	TGuardValue<bool> ParallelGuard(Settings->bParallelQueryFiltering, false);
+
+	FTestInstance Instance;
+	URogueliteSubsystem* Subsystem = Instance.GetSubsystem();
+	for (int32 i = 0; i < 32; ++i)
+	{
+		Instance.AddAction(i % 2 == 0 ? TAG_RogueliteTest_Pool_A : TAG_RogueliteTest_Pool_B, 1.f + i);
+	}
+	Subsystem->StartRun(4);
+
+	FRogueliteQuery QueryA;
+	QueryA.PoolTags.AddTag(TAG_RogueliteTest_Pool_A);
+	QueryA.Count = 3;
+	FRogueliteQuery QueryB;
+	QueryB.PoolTags.AddTag(TAG_RogueliteTest_Pool_B);
+	QueryB.Count = 3;
+	URogueliteActionData* Buffer[3];
+
+	// 워밍업: 임시 버퍼와 풀별 랜덤 스트림 확보
+	Subsystem->ExecuteQueryInto(QueryA, MakeArrayView(Buffer));
+	Subsystem->ExecuteQueryInto(QueryB, MakeArrayView(Buffer));
+
+	int64 NumAllocations = 0;
+	{
+		FRogueliteScopedMallocCounter MallocCounter;
+		for (int32 i = 0; i < 100; ++i)
+		{
+			Subsystem->ExecuteQueryInto(i % 2 == 0 ? QueryA : QueryB, MakeArrayView(Buffer));
+		}
+		NumAllocations = MallocCounter.GetNumAllocations();
+	}
+	TestEqual(TEXT("Steady-state query allocations"), NumAllocations, static_cast<int64>(0));
+
+	Subsystem->EndRun(false);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteQueryReplayBufferTest, "Roguelite.Query.ReplayRecordingReusesEventBuffer", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteQueryReplayBufferTest::RunTest(const FString& Parameters)
+{
+	URogueliteSettings* Settings = GetMutableDefault<URogueliteSettings>();
+	TGuardValue<bool> ReplayGuard(Settings->bEnableReplayLog, true);
+	TGuardValue<FString> DirGuard(Settings->ReplayLogDirectory, TEXT("Automation/RogueliteReplay"));
+	TGuardValue<bool> LoggingGuard(Settings->bEnableDebugLogging, false);
+	TGuardValue<bool> ParallelGuard(Settings->bParallelQueryFiltering, false);
+
+	FTestInstance Instance;
+	URogueliteSubsystem* Subsystem = Instance.GetSubsystem();
+	for (int32 i = 0; i < 32; ++i)
+	{
+		Instance.AddAction(TAG_RogueliteTest_Pool_A, 1.f + i);
+	}
+	Subsystem->StartRun(4);
+	const FString FilePath = Subsystem->GetReplayLogPath();
+
+	FRogueliteQuery Query;
+	Query.PoolTags.AddTag(TAG_RogueliteTest_Pool_A);
+	Query.Count = 3;
+	URogueliteActionData* Buffer[3];
+	Subsystem->ExecuteQueryInto(Query, MakeArrayView(Buffer));
+
+	// 쿼리 이벤트의 결과 경로 배열은 임시 버퍼에 포함되어 재사용됨
+	const int32 GrowthBefore = Subsystem->GetQueryScratchGrowthCount();
+	int64 NumAllocations = 0;
+	{
+		FRogueliteScopedMallocCounter MallocCounter;
+		for (int32 i = 0; i < 100; ++i)
+		{
+			Subsystem->ExecuteQueryInto(Query, MakeArrayView(Buffer));
+		}
+		NumAllocations = MallocCounter.GetNumAllocations();
+	}
+	TestEqual(TEXT("Replay event buffer reused"), Subsystem->GetQueryScratchGrowthCount(), GrowthBefore);
+
+	// 경로 문자열 변환/직렬화 할당은 리플레이 기록의 알려진 예외 (할당 0 조건에서 제외)
+	AddInfo(FString::Printf(TEXT("Allocations per recorded query: %.1f"), NumAllocations / 100.0));
+
+	Subsystem->EndRun(false);
+	IFileManager::Get().Delete(*FilePath);
+	return true;
+}
+
+#endif
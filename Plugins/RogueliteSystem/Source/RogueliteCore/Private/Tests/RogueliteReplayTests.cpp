@@ -0,0 +1,253 @@
+#include "RogueliteTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "RogueliteSubsystem.h"
+#include "RogueliteActionData.h"
+#include "RogueliteReplayLog.h"
+#include "RogueliteSettings.h"
+#include "RogueliteWeightedPool.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+using namespace RogueliteTests;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteReplayLogRoundTripTest, "Roguelite.Replay.LogRoundTrip", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteReplayLogRoundTripTest::RunTest(const FString& Parameters)
+{
+	const FString FilePath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("RogueliteReplayRoundTrip.rlog"));
+
+	FRogueliteReplayLog Log;
+	TestTrue(TEXT("Open"), Log.Open(FilePath, 1234));
+
+	FRogueliteReplayEvent RemoveEvent;
+	RemoveEvent.Type = ERogueliteReplayEventType::Remove;
+	RemoveEvent.ActionPaths.Add(FSoftObjectPath(TEXT("/Game/Test/Action.Action")));
+	RemoveEvent.Stacks = 2;
+	RemoveEvent.bRemoveAll = true;
+	Log.Append(RemoveEvent);
+
+	FRogueliteReplayEvent ValueEvent;
+	ValueEvent.Type = ERogueliteReplayEventType::SetValue;
+	ValueEvent.Tag = TAG_RogueliteTest_Stat_Attack;
+	ValueEvent.Value = 12.5f;
+	Log.Append(ValueEvent);
+
+	FRogueliteReplayEvent RestoreEvent;
+	RestoreEvent.Type = ERogueliteReplayEventType::Restore;
+	RestoreEvent.Payload = { 1, 2, 3, 4 };
+	Log.Append(RestoreEvent);
+
+	// 열린 상태에서도 기록된 레코드는 읽을 수 있어야 함
+	int32 LoadedSeed = 0;
+	TArray<FRogueliteReplayEvent> Loaded;
+	TestTrue(TEXT("Load while open"), FRogueliteReplayLog::LoadFromFile(FilePath, LoadedSeed, Loaded));
+	TestEqual(TEXT("Event count while open"), Loaded.Num(), 3);
+	Log.Close();
+
+	TestTrue(TEXT("Load"), FRogueliteReplayLog::LoadFromFile(FilePath, LoadedSeed, Loaded));
+	TestEqual(TEXT("Seed"), LoadedSeed, 1234);
+	if (TestEqual(TEXT("Event count"), Loaded.Num(), 3))
+	{
+		TestTrue(TEXT("Remove type"), Loaded[0].Type == ERogueliteReplayEventType::Remove);
+		TestEqual(TEXT("Remove stacks"), Loaded[0].Stacks, 2);
+		TestTrue(TEXT("bRemoveAll"), Loaded[0].bRemoveAll);
+		TestTrue(TEXT("Value key"), Loaded[1].Tag == TAG_RogueliteTest_Stat_Attack);
+		TestEqual(TEXT("Value"), Loaded[1].Value, 12.5f);
+		TestEqual(TEXT("Payload"), Loaded[2].Payload.Num(), 4);
+	}
+
+	IFileManager::Get().Delete(*FilePath);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteReplayReproduceTest, "Roguelite.Replay.Reproduce", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteReplayReproduceTest::RunTest(const FString& Parameters)
+{
+	URogueliteSettings* Settings = GetMutableDefault<URogueliteSettings>();
+	TGuardValue<bool> LogGuard(Settings->bEnableReplayLog, true);
+	TGuardValue<FString> DirGuard(Settings->ReplayLogDirectory, TEXT("Automation/RogueliteReplay"));
+
+	FTestInstance Instance;
+	URogueliteSubsystem* Subsystem = Instance.GetSubsystem();
+	for (int32 Index = 0; Index < 8; ++Index)
+	{
+		Instance.AddAction(Index % 2 == 0 ? TAG_RogueliteTest_Kind_Fire : TAG_RogueliteTest_Kind_Ice, 1.f + Index, 3);
+	}
+
+	Subsystem->StartRun(4242);
+	const FString FilePath = Subsystem->GetReplayLogPath();
+	TestFalse(TEXT("Log path"), FilePath.IsEmpty());
+
+	FRogueliteQuery Query;
+	Query.Count = 3;
+	Query.RandomStreamTag = TAG_RogueliteTest_Pool_A;
+	for (URogueliteActionData* Action : Subsystem->ExecuteQuery(Query))
+	{
+		Subsystem->AcquireAction(Action, 2);
+	}
+	URogueliteActionData* Removed = Subsystem->GetAcquiredAt(0);
+	Subsystem->RemoveAction(Removed, 1, true);
+	Subsystem->SetRunStateValue(TAG_RogueliteTest_Stat_Attack, 7.f);
+	Subsystem->AddTagToSystem(TAG_RogueliteTest_Pool_B);
+	Subsystem->ExecuteQuery(Query);
+
+	const FRogueliteRunSaveData Expected = Subsystem->CreateRunSaveData();
+	Subsystem->EndRun(false);
+
+	FString FailReason;
+	TestTrue(TEXT("Replay succeeded"), Subsystem->ReplayRunFromLog(FilePath, FailReason));
+	TestTrue(TEXT("Run active"), Subsystem->IsRunActive());
+	TestFalse(TEXT("Removed action absent"), Subsystem->HasAction(Removed));
+	TestEqual(TEXT("Acquired count"), Subsystem->GetAcquiredCount(), Expected.AcquiredActions.Num());
+	TestEqual(TEXT("Value"), Subsystem->GetRunStateValue(TAG_RogueliteTest_Stat_Attack), 7.f);
+	TestTrue(TEXT("System tag"), Subsystem->HasTagInSystem(TAG_RogueliteTest_Pool_B));
+
+	// 재현 직후 상태를 비교 (여기서 쿼리하면 그 쿼리도 기록되고 스트림이 진행됨)
+	const FRogueliteRunSaveData Replayed = Subsystem->CreateRunSaveData();
+	TestTrue(TEXT("Stream states"), Replayed.RandomStreamStates.OrderIndependentCompareEqual(Expected.RandomStreamStates));
+	TestTrue(TEXT("Acquired actions"), Replayed.AcquiredActions.OrderIndependentCompareEqual(Expected.AcquiredActions));
+
+	Subsystem->EndRun(false);
+	IFileManager::Get().Delete(*FilePath);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteReplayWeightedPoolTest, "Roguelite.Replay.WeightedPoolDraws", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteReplayWeightedPoolTest::RunTest(const FString& Parameters)
+{
+	URogueliteSettings* Settings = GetMutableDefault<URogueliteSettings>();
+	TGuardValue<bool> LogGuard(Settings->bEnableReplayLog, true);
+	TGuardValue<FString> DirGuard(Settings->ReplayLogDirectory, TEXT("Automation/RogueliteReplay"));
+
+	FTestInstance Instance;
+	URogueliteSubsystem* Subsystem = Instance.GetSubsystem();
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		Instance.AddAction(TAG_RogueliteTest_Kind_Fire, 1.f + Index, 3);
+	}
+
+	FRogueliteWeightedPool Pool;
+	for (int32 Index = 0; Index < 6; ++Index)
+	{
+		Pool.Entries.AddDefaulted_GetRef().Weight = 1.f + Index;
+	}
+
+	// 쿼리와 같은 스트림을 쓰는 웨이브 추첨이 끼어 있어도 재현되어야 함
+	Subsystem->StartRun(77);
+	const FString FilePath = Subsystem->GetReplayLogPath();
+	FRogueliteQuery Query;
+	Query.Count = 2;
+	Query.RandomStreamTag = TAG_RogueliteTest_Pool_A;
+	Subsystem->DrawFromWeightedPool(Pool, TAG_RogueliteTest_Pool_A, 5);
+	Subsystem->ExecuteQuery(Query);
+	Subsystem->DrawFromWeightedPool(Pool, TAG_RogueliteTest_Pool_B, 3, true);
+	const FRogueliteRunSaveData Expected = Subsystem->CreateRunSaveData();
+	Subsystem->EndRun(false);
+
+	int32 LoggedSeed = 0;
+	TArray<FRogueliteReplayEvent> Events;
+	FRogueliteReplayLog::LoadFromFile(FilePath, LoggedSeed, Events);
+	TestEqual(TEXT("Draw events logged"), Events.FilterByPredicate([](const FRogueliteReplayEvent& Event) { return Event.Type == ERogueliteReplayEventType::DrawPool; }).Num(), 2);
+
+	FString FailReason;
+	TestTrue(TEXT("Replay succeeded"), Subsystem->ReplayRunFromLog(FilePath, FailReason));
+	TestTrue(TEXT("Stream states"), Subsystem->CreateRunSaveData().RandomStreamStates.OrderIndependentCompareEqual(Expected.RandomStreamStates));
+
+	Subsystem->EndRun(false);
+	IFileManager::Get().Delete(*FilePath);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteReplayResumeTruncatedTest, "Roguelite.Replay.ResumeDropsPartialRecord", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteReplayResumeTruncatedTest::RunTest(const FString& Parameters)
+{
+	const FString FilePath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("RogueliteReplayResume.rlog"));
+
+	FRogueliteReplayEvent ValueEvent;
+	ValueEvent.Type = ERogueliteReplayEventType::SetValue;
+	ValueEvent.Tag = TAG_RogueliteTest_Stat_Attack;
+	ValueEvent.Value = 1.f;
+	{
+		FRogueliteReplayLog Log;
+		Log.Open(FilePath, 7);
+		Log.Append(ValueEvent);
+		Log.Close();
+	}
+
+	int32 LoadedSeed = 0;
+	TArray<FRogueliteReplayEvent> Loaded;
+	int64 CompleteSize = 0;
+	FRogueliteReplayLog::LoadFromFile(FilePath, LoadedSeed, Loaded, &CompleteSize);
+	TestEqual(TEXT("Valid size is file size"), CompleteSize, IFileManager::Get().FileSize(*FilePath));
+
+	// 크래시로 레코드 길이만 쓰이고 내용이 잘린 상황
+	{
+		TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath, FILEWRITE_Append));
+		int32 PayloadSize = 64;
+		uint8 Partial[3] = { 1, 2, 3 };
+		*Writer << PayloadSize;
+		Writer->Serialize(Partial, sizeof(Partial));
+	}
+
+	int64 ValidSize = 0;
+	TestTrue(TEXT("Load truncated"), FRogueliteReplayLog::LoadFromFile(FilePath, LoadedSeed, Loaded, &ValidSize));
+	TestEqual(TEXT("Partial record ignored"), Loaded.Num(), 1);
+	TestEqual(TEXT("Valid size excludes partial record"), ValidSize, CompleteSize);
+
+	{
+		FRogueliteReplayLog Log;
+		TestTrue(TEXT("Resume"), Log.Resume(FilePath));
+		ValueEvent.Value = 2.f;
+		Log.Append(ValueEvent);
+		Log.Close();
+	}
+
+	// 잘린 꼬리 뒤에 붙었다면 두 번째 이벤트를 읽지 못함
+	TestTrue(TEXT("Load resumed"), FRogueliteReplayLog::LoadFromFile(FilePath, LoadedSeed, Loaded));
+	if (TestEqual(TEXT("Event count after resume"), Loaded.Num(), 2))
+	{
+		TestEqual(TEXT("Resumed value"), Loaded[1].Value, 2.f);
+	}
+
+	IFileManager::Get().Delete(*FilePath);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteReplayDesyncTest, "Roguelite.Replay.DesyncEndsRun", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteReplayDesyncTest::RunTest(const FString& Parameters)
+{
+	const FString FilePath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("RogueliteReplayDesync.rlog"));
+
+	FTestInstance Instance;
+	URogueliteSubsystem* Subsystem = Instance.GetSubsystem();
+	URogueliteActionData* Action = Instance.AddAction(TAG_RogueliteTest_Kind_Fire);
+
+	// 보유하지 않은 액션 제거는 재현 실패
+	{
+		FRogueliteReplayLog Log;
+		Log.Open(FilePath, 99);
+
+		FRogueliteReplayEvent Event;
+		Event.Type = ERogueliteReplayEventType::Remove;
+		Event.ActionPaths.Add(FSoftObjectPath(Action));
+		Event.Stacks = 1;
+		Log.Append(Event);
+		Log.Close();
+	}
+
+	FString FailReason;
+	TestFalse(TEXT("Replay failed"), Subsystem->ReplayRunFromLog(FilePath, FailReason));
+	TestFalse(TEXT("Fail reason"), FailReason.IsEmpty());
+	TestFalse(TEXT("Run ended"), Subsystem->IsRunActive());
+
+	IFileManager::Get().Delete(*FilePath);
+	return true;
+}
+
+#endif
@@ -0,0 +1,160 @@
+#include "RogueliteTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "RogueliteSubsystem.h"
+#include "Async/Async.h"
+#include <atomic>
+
+using namespace RogueliteTests;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteSnapshotReadOnlyAccessTest, "Roguelite.Snapshot.ReadDoesNotDirty", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteSnapshotReadOnlyAccessTest::RunTest(const FString& Parameters)
+{
+	FTestInstance Instance;
+	URogueliteSubsystem* Subsystem = Instance.GetSubsystem();
+	Subsystem->StartRun(7);
+
+	const int32 Version = Subsystem->GetRunStateVersion();
+	const FRogueliteRunStateSnapshotPtr Before = Subsystem->GetRunStateSnapshot();
+	Subsystem->GetRunState();
+	Subsystem->GetRunStateConst();
+	TestEqual(TEXT("Read keeps version"), Subsystem->GetRunStateVersion(), Version);
+	TestTrue(TEXT("Read keeps snapshot"), Subsystem->GetRunStateSnapshot() == Before);
+
+	Subsystem->MutateRunState([](FRogueliteRunState& State)
+	{
+		State.NumericData.Add(TAG_RogueliteTest_Stat_Attack, 3.f);
+	});
+	TestNotEqual(TEXT("Mutate bumps version"), Subsystem->GetRunStateVersion(), Version);
+
+	const FRogueliteRunStateSnapshotPtr After = Subsystem->GetRunStateSnapshot();
+	if (TestTrue(TEXT("Snapshot"), After.IsValid()))
+	{
+		TestEqual(TEXT("Snapshot value"), After->State.NumericData.FindRef(TAG_RogueliteTest_Stat_Attack), 3.f);
+	}
+
+	Subsystem->EndRun(false);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteSnapshotLifetimeTest, "Roguelite.Snapshot.HeldAcrossPublishes", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteSnapshotLifetimeTest::RunTest(const FString& Parameters)
+{
+	FTestInstance Instance;
+	URogueliteSubsystem* Subsystem = Instance.GetSubsystem();
+	Subsystem->StartRun(7);
+
+	// 워커에서 계속 스냅샷을 가져와 읽는 동안 게임 스레드는 쉬지 않고 새 스냅샷 게시
+	std::atomic<bool> bStop { false };
+	std::atomic<int32> Reads { 0 };
+	TFuture<void> Reader = Async(EAsyncExecution::ThreadPool, [Subsystem, &bStop, &Reads]()
+	{
+		while (!bStop.load())
+		{
+			if (const FRogueliteRunStateSnapshotPtr Snapshot = Subsystem->GetRunStateSnapshot())
+			{
+				++Reads;
+			}
+		}
+	});
+
+	const FRogueliteRunStateSnapshotPtr Held = Subsystem->GetRunStateSnapshot();
+	for (int32 Index = 0; Index < 2000; ++Index)
+	{
+		Subsystem->SetRunStateValue(TAG_RogueliteTest_Stat_Attack, static_cast<float>(Index));
+		Subsystem->GetRunStateSnapshot();
+	}
+	bStop = true;
+	Reader.Wait();
+
+	TestTrue(TEXT("Reader ran"), Reads.load() > 0);
+	if (TestTrue(TEXT("Held snapshot"), Held.IsValid()))
+	{
+		// 수많은 교체 뒤에도 보관한 스냅샷은 처음 상태 그대로
+		TestFalse(TEXT("Held snapshot unchanged"), Held->State.NumericData.Contains(TAG_RogueliteTest_Stat_Attack));
+	}
+
+	Subsystem->EndRun(false);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteSnapshotConsistencyTest, "Roguelite.Snapshot.VersionMatchesContents", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteSnapshotConsistencyTest::RunTest(const FString& Parameters)
+{
+	FTestInstance Instance;
+	URogueliteSubsystem* Subsystem = Instance.GetSubsystem();
+	Subsystem->StartRun(7);
+
+	constexpr int32 WriteCount = 2000;
+
+	// 쓰기마다 두 값을 함께 바꾸고, 그 결과 버전에 어떤 값을 썼는지 기록
+	TMap<uint32, int32> WrittenByVersion;
+	WrittenByVersion.Reserve(WriteCount);
+
+	struct FObservation
+	{
+		uint32 Version = 0;
+		float Attack = 0.f;
+		float Mirror = 0.f;
+	};
+
+	std::atomic<bool> bStop { false };
+	TFuture<TArray<FObservation>> Reader = Async(EAsyncExecution::ThreadPool, [Subsystem, &bStop]()
+	{
+		TArray<FObservation> Observations;
+		uint32 LastVersion = 0;
+		while (!bStop.load())
+		{
+			const FRogueliteRunStateSnapshotPtr Snapshot = Subsystem->GetRunStateSnapshot();
+			if (Snapshot.IsValid() && Snapshot->Version != LastVersion)
+			{
+				LastVersion = Snapshot->Version;
+				FObservation& Observation = Observations.AddDefaulted_GetRef();
+				Observation.Version = Snapshot->Version;
+				Observation.Attack = Snapshot->State.NumericData.FindRef(TAG_RogueliteTest_Stat_Attack);
+				Observation.Mirror = Snapshot->State.NumericData.FindRef(TAG_RogueliteTest_Kind_Fire);
+			}
+		}
+		return Observations;
+	});
+
+	// 게시는 워커가 아니라 코어 티커(TickRunStateSnapshot)가 담당
+	for (int32 Index = 1; Index <= WriteCount; ++Index)
+	{
+		Subsystem->MutateRunState([Index](FRogueliteRunState& State)
+		{
+			State.NumericData.Add(TAG_RogueliteTest_Stat_Attack, static_cast<float>(Index));
+			State.NumericData.Add(TAG_RogueliteTest_Kind_Fire, static_cast<float>(-Index));
+		});
+		WrittenByVersion.Add(static_cast<uint32>(Subsystem->GetRunStateVersion()), Index);
+		FTSTicker::GetCoreTicker().Tick(0.f);
+	}
+	bStop = true;
+	const TArray<FObservation> Observations = Reader.Get();
+
+	TestTrue(TEXT("Reader observed publishes"), Observations.Num() > 1);
+
+	int32 Mismatches = 0;
+	uint32 PreviousVersion = 0;
+	for (const FObservation& Observation : Observations)
+	{
+		// 쓰기 전 버전(StartRun 직후)은 값이 없어야 함
+		const int32* Written = WrittenByVersion.Find(Observation.Version);
+		const float Expected = Written ? static_cast<float>(*Written) : 0.f;
+		if (Observation.Attack != Expected || Observation.Mirror != -Expected || Observation.Version < PreviousVersion)
+		{
+			++Mismatches;
+		}
+		PreviousVersion = Observation.Version;
+	}
+	TestEqual(TEXT("Snapshot version matches contents"), Mismatches, 0);
+
+	Subsystem->EndRun(false);
+	return true;
+}
+
+#endif
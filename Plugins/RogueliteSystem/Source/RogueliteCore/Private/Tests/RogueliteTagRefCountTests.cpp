@@ -0,0 +1,85 @@
+#include "RogueliteTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "RogueliteSubsystem.h"
+#include "RogueliteActionData.h"
+
+using namespace RogueliteTests;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteTagRefCountRestoreTest, "Roguelite.Tags.RestoreRecomputesRefCounts", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteTagRefCountRestoreTest::RunTest(const FString& Parameters)
+{
+	FTestInstance Instance;
+	URogueliteSubsystem* Subsystem = Instance.GetSubsystem();
+
+	URogueliteActionData* First = Instance.AddAction(TAG_RogueliteTest_Kind_Fire);
+	URogueliteActionData* Second = Instance.AddAction(TAG_RogueliteTest_Kind_Fire);
+	First->bAutoGrantTags = true;
+	Second->bAutoGrantTags = true;
+
+	// 참조 수가 없는 구버전 세이브: 태그만 저장되어 있음
+	FRogueliteRunSaveData SaveData;
+	SaveData.AcquiredActions.Add(FSoftObjectPath(First), 2);
+	SaveData.AcquiredActions.Add(FSoftObjectPath(Second), 1);
+	SaveData.ActiveTags.AddTag(TAG_RogueliteTest_Kind_Fire);
+	SaveData.ActiveTags.AddTag(TAG_RogueliteTest_Pool_B);
+	SaveData.RandomSeed = 11;
+
+	Subsystem->RestoreRunFromSaveData(SaveData);
+	TestEqual(TEXT("Action-granted count"), Subsystem->GetTagRefCount(TAG_RogueliteTest_Kind_Fire), 2);
+	TestEqual(TEXT("Unowned legacy tag"), Subsystem->GetTagRefCount(TAG_RogueliteTest_Pool_B), 1);
+
+	// 한 액션을 완전히 제거해도 다른 액션이 부여한 태그는 유지
+	Subsystem->RemoveAction(First, 1, true);
+	TestTrue(TEXT("Still granted by second"), Subsystem->HasTagInSystem(TAG_RogueliteTest_Kind_Fire));
+	Subsystem->RemoveAction(Second, 1, true);
+	TestFalse(TEXT("Released with last owner"), Subsystem->HasTagInSystem(TAG_RogueliteTest_Kind_Fire));
+
+	// 구버전 태그는 시스템 부여분으로 복원되어 RemoveTag로 해제 가능
+	Subsystem->RemoveTagFromSystem(TAG_RogueliteTest_Pool_B);
+	TestFalse(TEXT("Legacy tag removable"), Subsystem->HasTagInSystem(TAG_RogueliteTest_Pool_B));
+
+	Subsystem->EndRun(false);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteTagSystemGrantTest, "Roguelite.Tags.SystemRemoveKeepsActionGrant", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteTagSystemGrantTest::RunTest(const FString& Parameters)
+{
+	FTestInstance Instance;
+	URogueliteSubsystem* Subsystem = Instance.GetSubsystem();
+
+	URogueliteActionData* Action = Instance.AddAction(TAG_RogueliteTest_Kind_Ice);
+	Action->bAutoGrantTags = true;
+
+	Subsystem->StartRun(3);
+	Subsystem->AcquireAction(Action);
+
+	// 시스템이 부여하지 않은 태그는 RemoveTag로 해제되지 않음
+	Subsystem->RemoveTagFromSystem(TAG_RogueliteTest_Kind_Ice);
+	TestTrue(TEXT("Action grant kept"), Subsystem->HasTagInSystem(TAG_RogueliteTest_Kind_Ice));
+	TestEqual(TEXT("Count unchanged"), Subsystem->GetTagRefCount(TAG_RogueliteTest_Kind_Ice), 1);
+
+	Subsystem->AddTagToSystem(TAG_RogueliteTest_Kind_Ice);
+	TestEqual(TEXT("System + action"), Subsystem->GetTagRefCount(TAG_RogueliteTest_Kind_Ice), 2);
+
+	// 세이브 왕복 후에도 출처별 참조 수 유지
+	const FRogueliteRunSaveData SaveData = Subsystem->CreateRunSaveData();
+	Subsystem->RestoreRunFromSaveData(SaveData);
+	TestEqual(TEXT("Round trip count"), Subsystem->GetTagRefCount(TAG_RogueliteTest_Kind_Ice), 2);
+
+	Subsystem->RemoveTagFromSystem(TAG_RogueliteTest_Kind_Ice);
+	Subsystem->RemoveTagFromSystem(TAG_RogueliteTest_Kind_Ice);
+	TestEqual(TEXT("Only system grant released"), Subsystem->GetTagRefCount(TAG_RogueliteTest_Kind_Ice), 1);
+
+	Subsystem->RemoveAction(Action, 1, true);
+	TestFalse(TEXT("Released with action"), Subsystem->HasTagInSystem(TAG_RogueliteTest_Kind_Ice));
+
+	Subsystem->EndRun(false);
+	return true;
+}
+
+#endif
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RogueliteQueryFilter.h"
+#include "RogueliteTestFilter.generated.h"
+
+/**
+ * 자동화 테스트용 필터.
+ * 통과 여부를 콜백으로 결정 (콜백이 없으면 통과). 스레드 안전 선언은 하지 않음.
+ */
+UCLASS(NotBlueprintable, Transient, HideDropdown)
+class URogueliteTestFilter_Callback : public URogueliteQueryFilter
+{
+	GENERATED_BODY()
+
+public:
+	TFunction<bool(URogueliteActionData*)> Callback;
+
+	virtual bool PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const override
+	{
+		return Callback ? Callback(Action) : true;
+	}
+};
@@ -0,0 +1,65 @@
+#include "RogueliteTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "RogueliteSubsystem.h"
+#include "RogueliteActionData.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "UObject/Package.h"
+
+UE_DEFINE_GAMEPLAY_TAG(TAG_RogueliteTest_Pool_A, "RogueliteTest.Pool.A");
+UE_DEFINE_GAMEPLAY_TAG(TAG_RogueliteTest_Pool_B, "RogueliteTest.Pool.B");
+UE_DEFINE_GAMEPLAY_TAG(TAG_RogueliteTest_Kind_Fire, "RogueliteTest.Kind.Fire");
+UE_DEFINE_GAMEPLAY_TAG(TAG_RogueliteTest_Kind_Ice, "RogueliteTest.Kind.Ice");
+UE_DEFINE_GAMEPLAY_TAG(TAG_RogueliteTest_Stat_Attack, "RogueliteTest.Stat.Attack");
+
+namespace RogueliteTests
+{
+	FTestInstance::FTestInstance()
+	{
+		GameInstance = NewObject<UGameInstance>(GEngine);
+		GameInstance->AddToRoot();
+		GameInstance->InitializeStandalone(MakeUniqueObjectName(GetTransientPackage(), UWorld::StaticClass(), TEXT("RogueliteTestWorld")));
+		Subsystem = GameInstance->GetSubsystem<URogueliteSubsystem>();
+	}
+
+	FTestInstance::~FTestInstance()
+	{
+		UWorld* World = GameInstance->GetWorld();
+		GameInstance->Shutdown();
+		if (World)
+		{
+			World->DestroyWorld(false);
+		}
+		GameInstance->RemoveFromRoot();
+		GameInstance->MarkAsGarbage();
+
+		for (URogueliteActionData* Action : Actions)
+		{
+			Action->RemoveFromRoot();
+			Action->MarkAsGarbage();
+		}
+	}
+
+	URogueliteActionData* FTestInstance::MakeAction(FGameplayTag Tag, float Weight, int32 MaxStacks)
+	{
+		URogueliteActionData* Action = NewObject<URogueliteActionData>(GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), URogueliteActionData::StaticClass(), TEXT("RogueliteTestAction")), RF_Transient);
+		Action->AddToRoot();
+		Action->ActionTags.AddTag(Tag);
+		Action->BaseWeight = Weight;
+		Action->MaxStacks = MaxStacks;
+		Actions.Add(Action);
+		return Action;
+	}
+
+	URogueliteActionData* FTestInstance::AddAction(FGameplayTag Tag, float Weight, int32 MaxStacks)
+	{
+		URogueliteActionData* Action = MakeAction(Tag, Weight, MaxStacks);
+		Subsystem->RegisterAction(Action);
+		return Action;
+	}
+}
+
+#endif
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "NativeGameplayTags.h"
+#include "Misc/AutomationTest.h"
+
+class UGameInstance;
+class URogueliteSubsystem;
+class URogueliteActionData;
+
+/*~ Test Tags ~*/
+
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_RogueliteTest_Pool_A);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_RogueliteTest_Pool_B);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_RogueliteTest_Kind_Fire);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_RogueliteTest_Kind_Ice);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_RogueliteTest_Stat_Attack);
+
+// 자동화 테스트 공통 플래그
+#define ROGUELITE_TEST_FLAGS (EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// 성능 회귀 테스트 플래그 (Perf 필터에서만 실행)
+#define ROGUELITE_PERF_TEST_FLAGS (EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+namespace RogueliteTests
+{
+	/**
+	 * 테스트 전용 게임 인스턴스.
+	 * InitializeStandalone으로 서브시스템 Initialize/Deinitialize를 정상 경로로 호출하고, 만든 액션은 소멸 시 정리.
+	 */
+	class FTestInstance
+	{
+	public:
+		FTestInstance();
+		~FTestInstance();
+
+		URogueliteSubsystem* GetSubsystem() const { return Subsystem; }
+
+		// 태그가 붙은 액션 생성 (등록은 하지 않음)
+		URogueliteActionData* MakeAction(FGameplayTag Tag, float Weight = 1.f, int32 MaxStacks = 0);
+
+		// 액션 생성 후 등록
+		URogueliteActionData* AddAction(FGameplayTag Tag, float Weight = 1.f, int32 MaxStacks = 0);
+
+	private:
+		UGameInstance* GameInstance = nullptr;
+		URogueliteSubsystem* Subsystem = nullptr;
+		TArray<URogueliteActionData*> Actions;
+	};
+}
+
+#endif
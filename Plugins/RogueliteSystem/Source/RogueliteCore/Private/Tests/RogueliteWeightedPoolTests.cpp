@@ -0,0 +1,120 @@
+#include "RogueliteTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "RogueliteSubsystem.h"
+#include "RogueliteWeightedPool.h"
+
+using namespace RogueliteTests;
+
+namespace
+{
+	FRogueliteWeightedPool MakeTestPool()
+	{
+		FRogueliteWeightedPool Pool;
+		for (int32 i = 0; i < 8; ++i)
+		{
+			FRogueliteWeightedEntry& Entry = Pool.Entries.AddDefaulted_GetRef();
+			Entry.Weight = 1.f + i;
+			Entry.Tags.AddTag(i % 2 == 0 ? TAG_RogueliteTest_Kind_Fire : TAG_RogueliteTest_Kind_Ice);
+		}
+		Pool.WeightModifiers.Add(TAG_RogueliteTest_Kind_Fire, 3.f);
+		return Pool;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteWeightedPoolCacheTest, "Roguelite.WeightedPool.CachesUnbuiltPools", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteWeightedPoolCacheTest::RunTest(const FString& Parameters)
+{
+	FTestInstance Instance;
+	URogueliteSubsystem* Subsystem = Instance.GetSubsystem();
+	const FRogueliteWeightedPool Pool = MakeTestPool();
+
+	Subsystem->StartRun(5);
+	const TArray<int32> First = Subsystem->DrawFromWeightedPool(Pool, TAG_RogueliteTest_Pool_A, 16);
+	Subsystem->DrawFromWeightedPool(Pool, TAG_RogueliteTest_Pool_A, 16);
+	TestEqual(TEXT("Same content reuses cache"), Subsystem->GetCachedWeightedPoolCount(), 1);
+
+	FRogueliteWeightedPool Changed = Pool;
+	Changed.Entries[0].Weight = 20.f;
+	Subsystem->DrawFromWeightedPool(Changed, TAG_RogueliteTest_Pool_A, 1);
+	TestEqual(TEXT("Changed content builds new entry"), Subsystem->GetCachedWeightedPoolCount(), 2);
+	Subsystem->EndRun(false);
+
+	// 캐시 결과는 직접 빌드한 풀과 같은 추첨 결과
+	FRogueliteWeightedPool Built = Pool;
+	Built.Build();
+	Subsystem->StartRun(5);
+	const TArray<int32> FromBuilt = Subsystem->DrawFromWeightedPool(Built, TAG_RogueliteTest_Pool_A, 16);
+	TestEqual(TEXT("Cached matches prebuilt"), FromBuilt, First);
+	Subsystem->EndRun(false);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteWeightedPoolDrawUniqueTest, "Roguelite.WeightedPool.DrawUniqueWithScratch", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteWeightedPoolDrawUniqueTest::RunTest(const FString& Parameters)
+{
+	FRogueliteWeightedPool Pool = MakeTestPool();
+	Pool.Build();
+
+	// 호출자 버퍼 유무와 관계없이 같은 결과
+	FRogueliteWeightedDrawScratch Scratch;
+	FRandomStream StreamA(42);
+	FRandomStream StreamB(42);
+	TArray<int32> WithScratch;
+	TArray<int32> WithoutScratch;
+	for (int32 Round = 0; Round < 32; ++Round)
+	{
+		Pool.DrawUnique(StreamA, 5, WithScratch, &Scratch);
+		Pool.DrawUnique(StreamB, 5, WithoutScratch);
+		if (!TestEqual(TEXT("Scratch does not change result"), WithScratch, WithoutScratch))
+		{
+			break;
+		}
+
+		TSet<int32> Unique(WithScratch);
+		TestEqual(TEXT("No duplicates"), Unique.Num(), WithScratch.Num());
+	}
+
+	Pool.DrawUnique(StreamA, 100, WithScratch, &Scratch);
+	TestEqual(TEXT("Clamped to entry count"), WithScratch.Num(), Pool.Num());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRogueliteWeightedPoolZeroWeightTest, "Roguelite.WeightedPool.NeverDrawsZeroWeight", ROGUELITE_TEST_FLAGS)
+
+bool FRogueliteWeightedPoolZeroWeightTest::RunTest(const FString& Parameters)
+{
+	// 앞/중간/끝의 가중치 0 항목은 추첨 값이 0이거나 합계와 같아도 뽑히면 안 됨
+	const float Weights[] = { 0.f, 0.f, 1.f, 0.f, 2.f, 0.f };
+	FRogueliteWeightedPool Pool;
+	Pool.BuildFromWeights(TConstArrayView<float>(Weights));
+
+	FRandomStream Stream(3);
+	int32 ZeroWeightDraws = 0;
+	for (int32 Round = 0; Round < 2000; ++Round)
+	{
+		const int32 Index = Pool.Draw(Stream);
+		if (Weights[Index] <= 0.f)
+		{
+			++ZeroWeightDraws;
+		}
+	}
+	TestEqual(TEXT("Draw skips zero weights"), ZeroWeightDraws, 0);
+
+	TArray<int32> Picked;
+	for (int32 Round = 0; Round < 200; ++Round)
+	{
+		Pool.DrawUnique(Stream, 2, Picked);
+		Picked.Sort();
+		if (!TestEqual(TEXT("DrawUnique picks only positive weights"), Picked, TArray<int32>({ 2, 4 })))
+		{
+			break;
+		}
+	}
+	return true;
+}
+
+#endif
@@ -4,6 +4,8 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "GameplayTagContainer.h"
 #include "RogueliteTypes.h"
+#include "RogueliteWeightedPool.h"
+#include "RogueliteQueryReport.h"
 #include "RogueliteLibrary.generated.h"
 
 class URogueliteActionData;
@@ -44,11 +46,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|DB", meta = (WorldContext = "WorldContextObject"))
 	static TArray<URogueliteActionData*> GetActionsByTag(const UObject* WorldContextObject, FGameplayTag Tag);
 
+	// 등록된 액션 수
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|DB", meta = (WorldContext = "WorldContextObject"))
+	static int32 GetActionCount(const UObject* WorldContextObject);
+
+	// 인덱스로 등록된 액션 조회
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|DB", meta = (WorldContext = "WorldContextObject"))
+	static URogueliteActionData* GetActionAt(const UObject* WorldContextObject, int32 Index);
+
 	/*~ Run ~*/
 
-	// 런 시작
+	// 런 시작 (Seed = 0이면 새 시드 생성)
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Run", meta = (WorldContext = "WorldContextObject"))
-	static void StartRun(const UObject* WorldContextObject);
+	static void StartRun(const UObject* WorldContextObject, int32 Seed = 0);
 
 	// 런 종료
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Run", meta = (WorldContext = "WorldContextObject"))
@@ -58,10 +68,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Run", meta = (WorldContext = "WorldContextObject"))
 	static bool IsRunActive(const UObject* WorldContextObject);
 
-	// RunState 직접 접근
+	// RunState 직접 접근 (전체 복사이므로 GetRunStateVersion이 바뀌었을 때만 호출 권장)
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Run", meta = (WorldContext = "WorldContextObject"))
 	static FRogueliteRunState GetRunState(const UObject* WorldContextObject);
 
+	// RunState 변경 버전 (UI 폴링 시 이전 값과 같으면 갱신 생략)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Run", meta = (WorldContext = "WorldContextObject"))
+	static int32 GetRunStateVersion(const UObject* WorldContextObject);
+
+	// 분류별 변경 버전
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Run", meta = (WorldContext = "WorldContextObject"))
+	static int32 GetChangeVersion(const UObject* WorldContextObject, ERogueliteChangeCategory Category);
+
+	// 현재 런 시드
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Run", meta = (WorldContext = "WorldContextObject"))
+	static int32 GetRunSeed(const UObject* WorldContextObject);
+
 	/*~ Query ~*/
 
 	// 프리셋으로 간편 쿼리
@@ -72,10 +94,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Query", meta = (WorldContext = "WorldContextObject"))
 	static TArray<URogueliteActionData*> QueryByTag(const UObject* WorldContextObject, FGameplayTag PoolTag, int32 Count = 3);
 
+	// 가중치 풀 누적 테이블 계산 (풀 구성 후 한 번)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Query")
+	static void BuildWeightedPool(UPARAM(ref) FRogueliteWeightedPool& Pool);
+
+	// 가중치 풀에서 Count개 추첨 (웨이브 단위 스폰 등)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Query", meta = (WorldContext = "WorldContextObject"))
+	static TArray<int32> DrawFromWeightedPool(const UObject* WorldContextObject, const FRogueliteWeightedPool& Pool, FGameplayTag StreamKey, int32 Count = 1, bool bUnique = false);
+
 	// 쿼리 실행
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Query", meta = (WorldContext = "WorldContextObject"))
 	static TArray<URogueliteActionData*> ExecuteQuery(const UObject* WorldContextObject, const FRogueliteQuery& QueryStruct);
 
+	// explain 모드로 쿼리 실행
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Query", meta = (WorldContext = "WorldContextObject"))
+	static TArray<URogueliteActionData*> ExecuteQueryWithReport(const UObject* WorldContextObject, const FRogueliteQuery& QueryStruct, FRogueliteQueryReport& OutReport);
+
+	// 마지막 explain 쿼리 리포트
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Query", meta = (WorldContext = "WorldContextObject"))
+	static FRogueliteQueryReport GetLastQueryReport(const UObject* WorldContextObject);
+
+	// 리포트 문자열 (디버그 위젯용)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Query")
+	static FString QueryReportToString(const FRogueliteQueryReport& Report);
+
 	/*~ Action ~*/
 
 	// 액션 획득
@@ -106,6 +148,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Action", meta = (WorldContext = "WorldContextObject"))
 	static TArray<URogueliteActionData*> GetAcquiredWithTag(const UObject* WorldContextObject, FGameplayTag Tag);
 
+	// 태그를 가진 획득 액션 수
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Action", meta = (WorldContext = "WorldContextObject"))
+	static int32 GetAcquiredCountWithTag(const UObject* WorldContextObject, FGameplayTag Tag);
+
+	// 태그를 가진 획득 액션의 스택 합계
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Action", meta = (WorldContext = "WorldContextObject"))
+	static int32 GetAcquiredStacksWithTag(const UObject* WorldContextObject, FGameplayTag Tag);
+
+	// 획득 액션 수
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Action", meta = (WorldContext = "WorldContextObject"))
+	static int32 GetAcquiredCount(const UObject* WorldContextObject);
+
+	// 인덱스로 획득 액션 조회
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Action", meta = (WorldContext = "WorldContextObject"))
+	static URogueliteActionData* GetAcquiredAt(const UObject* WorldContextObject, int32 Index);
+
 	/*~ Tags ~*/
 
 	// 태그 추가
@@ -116,6 +174,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Tags", meta = (WorldContext = "WorldContextObject"))
 	static void RemoveTagFromSystem(const UObject* WorldContextObject, FGameplayTag Tag);
 
+	// 태그 참조 수
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Tags", meta = (WorldContext = "WorldContextObject"))
+	static int32 GetTagRefCount(const UObject* WorldContextObject, FGameplayTag Tag);
+
 	// 태그 보유 여부
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Tags", meta = (WorldContext = "WorldContextObject"))
 	static bool HasTagInSystem(const UObject* WorldContextObject, FGameplayTag Tag);
@@ -142,6 +204,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Numeric", meta = (WorldContext = "WorldContextObject"))
 	static TMap<FGameplayTag, float> GetAllRunStateValues(const UObject* WorldContextObject);
 
+	// 수치 항목 수
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Numeric", meta = (WorldContext = "WorldContextObject"))
+	static int32 GetRunStateValueCount(const UObject* WorldContextObject);
+
+	// 인덱스로 수치 항목 조회
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Numeric", meta = (WorldContext = "WorldContextObject"))
+	static bool GetRunStateValueAt(const UObject* WorldContextObject, int32 Index, FGameplayTag& OutKey, float& OutValue);
+
 	/*~ Slots ~*/
 
 	// 슬롯에 장착
@@ -156,6 +226,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Slots", meta = (WorldContext = "WorldContextObject"))
 	static TArray<URogueliteActionData*> GetSlotContents(const UObject* WorldContextObject, FGameplayTag SlotTag);
 
+	// 인덱스로 슬롯 액션 조회
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Slots", meta = (WorldContext = "WorldContextObject"))
+	static URogueliteActionData* GetSlotActionAt(const UObject* WorldContextObject, FGameplayTag SlotTag, int32 Index);
+
 	// 슬롯 사용 개수
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Slots", meta = (WorldContext = "WorldContextObject"))
 	static int32 GetSlotCount(const UObject* WorldContextObject, FGameplayTag SlotTag);
@@ -173,4 +247,10 @@ public:
 	// 세이브 데이터로 복원
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Save", meta = (WorldContext = "WorldContextObject"))
 	static void RestoreRunFromSaveData(const UObject* WorldContextObject, const FRogueliteRunSaveData& SaveData);
+
+	/*~ Replay ~*/
+
+	// 리플레이 로그로 런 재현
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Replay", meta = (WorldContext = "WorldContextObject"))
+	static bool ReplayRunFromLog(const UObject* WorldContextObject, const FString& FilePath, FString& OutFailReason);
 };
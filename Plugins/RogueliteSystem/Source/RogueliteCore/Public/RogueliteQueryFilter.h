@@ -6,6 +6,7 @@
 #include "RogueliteQueryFilter.generated.h"
 
 class URogueliteActionData;
+struct FRogueliteQueryReport;
 
 /**
  * 쿼리 필터 기본 클래스.
@@ -21,6 +22,17 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category = "Roguelite|Filter")
 	bool PassesFilter(URogueliteActionData* Action, const FRogueliteRunState& RunState) const;
 	virtual bool PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const;
+
+	// 필터 평가 (Report가 있으면 노드별 통과율 기록)
+	bool Evaluate(URogueliteActionData* Action, const FRogueliteRunState& RunState, FRogueliteQueryReport* Report) const;
+
+	// 워커 스레드에서 평가 가능 여부 (기본 false). 상태를 쓰지 않는 필터 클래스만 재정의해서 opt-in하고,
+	// 자식 클래스(네이티브/블루프린트)는 PassesFilter를 바꿀 수 있으므로 opt-in을 물려받지 않도록 정확한 클래스를 확인
+	virtual bool IsThreadSafe() const;
+
+protected:
+	// 하위 필터를 가진 필터는 재정의해서 하위 필터도 Evaluate로 평가
+	virtual bool EvaluateInternal(URogueliteActionData* Action, const FRogueliteRunState& RunState, FRogueliteQueryReport* Report) const;
 };
 
 /*~ Built-in Filters ~*/
@@ -35,6 +47,7 @@ class ROGUELITECORE_API URogueliteFilter_IsAcquired : public URogueliteQueryFilt
 
 public:
 	virtual bool PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const override;
+	virtual bool IsThreadSafe() const override;
 };
 
 /**
@@ -47,6 +60,7 @@ class ROGUELITECORE_API URogueliteFilter_NotAcquired : public URogueliteQueryFil
 
 public:
 	virtual bool PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const override;
+	virtual bool IsThreadSafe() const override;
 };
 
 /**
@@ -59,6 +73,7 @@ class ROGUELITECORE_API URogueliteFilter_NotMaxStacked : public URogueliteQueryF
 
 public:
 	virtual bool PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const override;
+	virtual bool IsThreadSafe() const override;
 };
 
 /**
@@ -79,6 +94,7 @@ public:
 	bool bRequireAll = true;
 
 	virtual bool PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const override;
+	virtual bool IsThreadSafe() const override;
 };
 
 UENUM(BlueprintType)
@@ -124,6 +140,7 @@ public:
 	bool bUseRunStateValue = true;
 
 	virtual bool PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const override;
+	virtual bool IsThreadSafe() const override;
 };
 
 /**
@@ -140,6 +157,10 @@ public:
 	TArray<URogueliteQueryFilter*> SubFilters;
 
 	virtual bool PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const override;
+	virtual bool IsThreadSafe() const override;
+
+protected:
+	virtual bool EvaluateInternal(URogueliteActionData* Action, const FRogueliteRunState& RunState, FRogueliteQueryReport* Report) const override;
 };
 
 /**
@@ -156,6 +177,10 @@ public:
 	TArray<URogueliteQueryFilter*> SubFilters;
 
 	virtual bool PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const override;
+	virtual bool IsThreadSafe() const override;
+
+protected:
+	virtual bool EvaluateInternal(URogueliteActionData* Action, const FRogueliteRunState& RunState, FRogueliteQueryReport* Report) const override;
 };
 
 /**
@@ -172,6 +197,10 @@ public:
 	URogueliteQueryFilter* SubFilter = nullptr;
 
 	virtual bool PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const override;
+	virtual bool IsThreadSafe() const override;
+
+protected:
+	virtual bool EvaluateInternal(URogueliteActionData* Action, const FRogueliteRunState& RunState, FRogueliteQueryReport* Report) const override;
 };
 
 /**
@@ -190,4 +219,5 @@ public:
 	FGameplayTagContainer ExcludeTags;
 
 	virtual bool PassesFilter_Implementation(URogueliteActionData* Action, const FRogueliteRunState& RunState) const override;
+	virtual bool IsThreadSafe() const override;
 };
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RogueliteQueryReport.generated.h"
+
+/*~ Query Explain ~*/
+
+UENUM(BlueprintType)
+enum class ERogueliteQueryStage : uint8
+{
+	// 무효 액션
+	Invalid,
+	// 쿼리/프리셋 RequireTags
+	RequireTags,
+	// 쿼리/프리셋 ExcludeTags
+	ExcludeTags,
+	// 액션 조건 (RequiredTags, BlockedByTags)
+	Conditions,
+	// 최대 스택 제외
+	MaxStacked,
+	// 쿼리 모드
+	Mode,
+	// 커스텀 필터
+	CustomFilter,
+	MAX UMETA(Hidden)
+};
+
+USTRUCT(BlueprintType)
+struct ROGUELITECORE_API FRogueliteQueryStageReport
+{
+	GENERATED_BODY()
+
+	// 단계
+	UPROPERTY(BlueprintReadOnly, Category = "Roguelite|Explain")
+	ERogueliteQueryStage Stage = ERogueliteQueryStage::Invalid;
+
+	// 이 단계까지 도달한 후보 수
+	UPROPERTY(BlueprintReadOnly, Category = "Roguelite|Explain")
+	int32 Evaluated = 0;
+
+	// 이 단계에서 탈락한 후보 수
+	UPROPERTY(BlueprintReadOnly, Category = "Roguelite|Explain")
+	int32 Rejected = 0;
+
+	// 누적 소요 시간
+	UPROPERTY(BlueprintReadOnly, Category = "Roguelite|Explain")
+	float TimeMs = 0.f;
+};
+
+USTRUCT(BlueprintType)
+struct ROGUELITECORE_API FRogueliteFilterNodeReport
+{
+	GENERATED_BODY()
+
+	// 필터 인스턴스 이름
+	UPROPERTY(BlueprintReadOnly, Category = "Roguelite|Explain")
+	FString FilterName;
+
+	// 필터 트리 깊이 (CustomFilter = 0)
+	UPROPERTY(BlueprintReadOnly, Category = "Roguelite|Explain")
+	int32 Depth = 0;
+
+	// 평가 횟수
+	UPROPERTY(BlueprintReadOnly, Category = "Roguelite|Explain")
+	int32 Evaluated = 0;
+
+	// 통과 횟수
+	UPROPERTY(BlueprintReadOnly, Category = "Roguelite|Explain")
+	int32 Passed = 0;
+
+	// 통과율 (0~1)
+	float GetPassRate() const { return Evaluated > 0 ? static_cast<float>(Passed) / Evaluated : 0.f; }
+};
+
+/**
+ * 쿼리 explain 리포트.
+ * 단계별 탈락 수/시간과 커스텀 필터 노드별 통과율. FRogueliteQuery::bExplain일 때만 수집.
+ */
+USTRUCT(BlueprintType)
+struct ROGUELITECORE_API FRogueliteQueryReport
+{
+	GENERATED_BODY()
+
+	// 프리셋 이름 또는 풀 태그
+	UPROPERTY(BlueprintReadOnly, Category = "Roguelite|Explain")
+	FString PoolName;
+
+	// 수집된 후보 수
+	UPROPERTY(BlueprintReadOnly, Category = "Roguelite|Explain")
+	int32 NumCandidates = 0;
+
+	// 모든 필터 통과 수
+	UPROPERTY(BlueprintReadOnly, Category = "Roguelite|Explain")
+	int32 NumPassed = 0;
+
+	// 최종 선택 수
+	UPROPERTY(BlueprintReadOnly, Category = "Roguelite|Explain")
+	int32 NumSelected = 0;
+
+	// 후보 수집 시간
+	UPROPERTY(BlueprintReadOnly, Category = "Roguelite|Explain")
+	float CollectTimeMs = 0.f;
+
+	// 필터링 시간
+	UPROPERTY(BlueprintReadOnly, Category = "Roguelite|Explain")
+	float FilterTimeMs = 0.f;
+
+	// 가중치 선택 시간
+	UPROPERTY(BlueprintReadOnly, Category = "Roguelite|Explain")
+	float SelectTimeMs = 0.f;
+
+	// 필터 단계별 결과 (ERogueliteQueryStage 순서)
+	UPROPERTY(BlueprintReadOnly, Category = "Roguelite|Explain")
+	TArray<FRogueliteQueryStageReport> Stages;
+
+	// 커스텀 필터 노드별 결과 (처음 평가된 순서)
+	UPROPERTY(BlueprintReadOnly, Category = "Roguelite|Explain")
+	TArray<FRogueliteFilterNodeReport> FilterNodes;
+
+	// 초기화 (단계 목록 생성)
+	void Reset();
+
+	// 단계 결과 누적
+	void RecordStage(ERogueliteQueryStage Stage, bool bPassed, double TimeMs);
+
+	// 필터 노드 평가 시작 (노드 인덱스 반환, 깊이 증가)
+	int32 BeginFilterNode(const UObject* Filter);
+
+	// 필터 노드 평가 종료
+	void EndFilterNode(int32 NodeIndex, bool bPassed);
+
+	// 로그/콘솔 출력용
+	FString ToString() const;
+
+private:
+	// 필터 인스턴스 -> FilterNodes 인덱스
+	TMap<const UObject*, int32> FilterNodeIndices;
+
+	// 현재 평가 중인 필터 깊이
+	int32 FilterDepth = 0;
+};
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+/*~ Replay Event ~*/
+
+enum class ERogueliteReplayEventType : uint8
+{
+	// 쿼리 실행 (스트림 상태 + 결과)
+	Query,
+	// 액션 획득
+	Acquire,
+	// 액션 제거
+	Remove,
+	// 슬롯 장착
+	Equip,
+	// 슬롯 해제
+	Unequip,
+	// 수치 설정
+	SetValue,
+	// 수동 태그 추가
+	AddTag,
+	// 수동 태그 해제
+	RemoveTag,
+	// 세이브 데이터로 복원
+	Restore,
+	// 가중치 풀 추첨 (스트림 상태만)
+	DrawPool
+};
+
+/**
+ * 리플레이 로그의 단일 이벤트.
+ * 런 상태를 바꾸는 호출을 순서대로 재현하기 위한 최소 정보만 보관.
+ */
+struct ROGUELITECORE_API FRogueliteReplayEvent
+{
+	// 이벤트 종류
+	ERogueliteReplayEventType Type = ERogueliteReplayEventType::Query;
+
+	// Query/DrawPool: 랜덤 스트림 키, Equip/Unequip: 슬롯 태그, SetValue: 수치 키, AddTag/RemoveTag: 대상 태그
+	FGameplayTag Tag;
+
+	// Query/DrawPool: 선택 전 스트림 상태
+	int32 StreamStateBefore = 0;
+
+	// Query/DrawPool: 선택 후 스트림 상태
+	int32 StreamStateAfter = 0;
+
+	// Query: 결과 목록, 그 외: 대상 액션 (1개)
+	TArray<FSoftObjectPath> ActionPaths;
+
+	// Acquire: 추가 스택, Remove: 제거 스택
+	int32 Stacks = 0;
+
+	// Remove: 전부 제거 여부
+	bool bRemoveAll = false;
+
+	// SetValue: 설정 후 값
+	float Value = 0.f;
+
+	// Restore: 직렬화된 FRogueliteRunSaveData
+	TArray<uint8> Payload;
+
+	friend ROGUELITECORE_API FArchive& operator<<(FArchive& Ar, FRogueliteReplayEvent& Event);
+};
+
+/**
+ * 런 단위 append-only 바이너리 리플레이 로그.
+ * 런 동안 파일을 열어 두고 이벤트마다 길이 접두 레코드를 덧붙인 뒤 flush하므로 크래시 시 마지막 레코드만 유실됨.
+ */
+class ROGUELITECORE_API FRogueliteReplayLog
+{
+public:
+	// 새 로그 파일 생성 (헤더 기록)
+	bool Open(const FString& InFilePath, int32 RunSeed);
+
+	// 기존 로그 파일 뒤에 이어서 기록 (크래시로 잘린 마지막 레코드는 먼저 잘라냄)
+	bool Resume(const FString& InFilePath);
+
+	// 기록 종료
+	void Close();
+
+	// 기록 중 여부
+	bool IsOpen() const { return Writer.IsValid(); }
+
+	// 현재 로그 파일 경로
+	const FString& GetFilePath() const { return FilePath; }
+
+	// 이벤트 추가
+	void Append(const FRogueliteReplayEvent& Event);
+
+	// 로그 파일 읽기 (잘린 마지막 레코드는 무시). OutValidSize = 마지막 완전한 레코드의 끝 오프셋
+	static bool LoadFromFile(const FString& InFilePath, int32& OutRunSeed, TArray<FRogueliteReplayEvent>& OutEvents, int64* OutValidSize = nullptr);
+
+private:
+	// 헤더와 레코드 파싱
+	static bool ParseLog(const TArray<uint8>& Data, int32& OutRunSeed, TArray<FRogueliteReplayEvent>& OutEvents, int64& OutValidSize);
+
+	// 기록 중인 파일 경로
+	FString FilePath;
+
+	// 런 동안 열어 두는 파일 기록기
+	TUniquePtr<FArchive> Writer;
+
+	// 직렬화 버퍼 (재사용)
+	TArray<uint8> WriteBuffer;
+};
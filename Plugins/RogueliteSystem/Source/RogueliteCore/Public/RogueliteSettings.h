@@ -32,6 +32,30 @@ public:
 	// UPROPERTY(Config, EditAnywhere, Category = "Auto Registration")
 	// TArray<FDirectoryPath> AutoRegisterPaths;
 
+	/*~ Replay ~*/
+
+	// 런 리플레이 로그 기록 여부
+	UPROPERTY(Config, EditAnywhere, Category = "Replay")
+	bool bEnableReplayLog = false;
+
+	// 리플레이 로그 저장 폴더 (Saved 폴더 기준 상대 경로)
+	UPROPERTY(Config, EditAnywhere, Category = "Replay", meta = (EditCondition = "bEnableReplayLog"))
+	FString ReplayLogDirectory = TEXT("Roguelite/Replays");
+
+	/*~ Query ~*/
+
+	// 후보가 많을 때 필터링을 ParallelFor로 분할 (커스텀 필터가 스레드 안전할 때만, explain 모드는 항상 직렬)
+	UPROPERTY(Config, EditAnywhere, Category = "Query")
+	bool bParallelQueryFiltering = false;
+
+	// 후보가 이 수 미만이면 직렬 필터링
+	UPROPERTY(Config, EditAnywhere, Category = "Query", meta = (EditCondition = "bParallelQueryFiltering", ClampMin = "1"))
+	int32 ParallelFilterThreshold = 4096;
+
+	// 워커 작업 하나가 맡는 후보 수
+	UPROPERTY(Config, EditAnywhere, Category = "Query", meta = (EditCondition = "bParallelQueryFiltering", ClampMin = "1"))
+	int32 ParallelFilterBatchSize = 512;
+
 	/*~ Debug ~*/
 
 	// 디버그 로깅 활성화
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/*~ Log ~*/
+
+ROGUELITECORE_API DECLARE_LOG_CATEGORY_EXTERN(LogRoguelite, Log, All);
+
+/*~ Stats (stat Roguelite) ~*/
+
+DECLARE_STATS_GROUP(TEXT("Roguelite"), STATGROUP_Roguelite, STATCAT_Advanced);
+
+/*~ Trace (-trace=cpu,roguelite) ~*/
+
+// 스탯이 빠지는 Shipping/Test 빌드에서도 Insights로 쿼리 비용을 보기 위한 전용 채널
+UE_TRACE_CHANNEL_EXTERN(RogueliteChannel, ROGUELITECORE_API);
+
+// 스탯이 있으면 스탯 카운터(cpu 채널로도 트레이스됨), 없으면 전용 트레이스 채널 스코프. 한 스코프당 이벤트 1개
+#if STATS
+#define ROGUELITE_SCOPE_CYCLE_COUNTER(Stat) SCOPE_CYCLE_COUNTER(Stat)
+#else
+#define ROGUELITE_SCOPE_CYCLE_COUNTER(Stat) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, RogueliteChannel)
+#endif
@@ -1,9 +1,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Misc/ScopeRWLock.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "GameplayTagContainer.h"
 #include "RogueliteTypes.h"
+#include "RogueliteReplayLog.h"
+#include "RogueliteWeightedPool.h"
+#include "RogueliteQueryReport.h"
 #include "RogueliteSubsystem.generated.h"
 
 class URogueliteActionData;
@@ -20,10 +25,68 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FRogueliteActionRemovedSignature,
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FRogueliteStackChangedSignature, URogueliteActionData*, Action, int32, OldStacks, int32, NewStacks);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FRogueliteQueryCompleteSignature, const FRogueliteQuery&, Query, const TArray<URogueliteActionData*>&, Results);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FRogueliteValueChangedSignature, FGameplayTag, Key, float, OldValue, float, NewValue);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FRogueliteTagChangedSignature, FGameplayTag, Tag, bool, bAdded);
+
+// 쿼리 완료 네이티브 델리게이트 (결과 배열 복사 없음, 호출 중에만 유효)
+DECLARE_MULTICAST_DELEGATE_TwoParams(FRogueliteQueryCompleteNativeSignature, const FRogueliteQuery&, TConstArrayView<URogueliteActionData*>);
 
 // 획득 전 체크 델리게이트 (false 반환 시 획득 차단)
 DECLARE_DYNAMIC_DELEGATE_RetVal_TwoParams(bool, FRoguelitePreAcquireCheckSignature, URogueliteActionData*, Action, const FRogueliteRunState&, RunState);
 
+/**
+ * 쿼리 파이프라인 임시 버퍼.
+ * 쿼리 깊이마다 하나를 두고 매 쿼리마다 Reset으로 재사용하므로 용량이 안정되면 파이프라인 내부 할당이 없음.
+ * 게임 스레드 전용.
+ */
+struct FRogueliteQueryScratch
+{
+	// 프리셋 병합용 태그 (프리셋이 있을 때만 사용)
+	FGameplayTagContainer PoolTags;
+	FGameplayTagContainer RequireTags;
+	FGameplayTagContainer ExcludeTags;
+
+	// 풀 태그가 여러 개일 때 중복 제거용
+	TSet<URogueliteActionData*> CandidateSet;
+
+	// 수집된 후보
+	TArray<URogueliteActionData*> Candidates;
+
+	// 필터 통과 후보
+	TArray<URogueliteActionData*> Filtered;
+
+	// 병렬 필터링 시 후보별 통과 여부
+	TArray<bool> PassMask;
+
+	// 후보별 가중치
+	TArray<float> Weights;
+
+	// 선택된 후보 인덱스
+	TArray<int32> PickedIndices;
+
+	// 최종 결과
+	TArray<URogueliteActionData*> Results;
+
+	// 가중치 선택 풀
+	FRogueliteWeightedPool Pool;
+
+	// explain 리포트 (완료 시 LastQueryReport로 복사)
+	FRogueliteQueryReport Report;
+
+	// 중복 없는 추첨 버퍼
+	FRogueliteWeightedDrawScratch DrawScratch;
+
+	// 리플레이 쿼리 이벤트 (결과 경로 배열 재사용)
+	FRogueliteReplayEvent ReplayEvent;
+
+	// 현재 확보된 용량 (바이트, 증가 감지용. 태그 컨테이너는 내부 배열이 비공개라 제외)
+	SIZE_T GetAllocatedSize() const
+	{
+		return CandidateSet.GetAllocatedSize() + Candidates.GetAllocatedSize() + Filtered.GetAllocatedSize() + PassMask.GetAllocatedSize()
+			+ Weights.GetAllocatedSize() + PickedIndices.GetAllocatedSize() + Results.GetAllocatedSize() + Pool.GetAllocatedSize()
+			+ DrawScratch.GetAllocatedSize() + ReplayEvent.ActionPaths.GetAllocatedSize();
+	}
+};
+
 /**
  * 로그라이트 시스템 핵심 서브시스템.
  * ActionDB 관리, RunState 관리, 쿼리 실행을 담당.
@@ -66,11 +129,33 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|DB")
 	TArray<URogueliteActionData*> GetActionsByTags(const FGameplayTagContainer& Tags, bool bRequireAll = false) const;
 
+	// 등록된 액션 수
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|DB")
+	int32 GetActionCount() const;
+
+	// 인덱스로 등록된 액션 조회 (복사 없음)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|DB")
+	URogueliteActionData* GetActionAt(int32 Index) const;
+
+	// 특정 태그를 가진 액션 수
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|DB")
+	int32 GetActionCountByTag(FGameplayTag Tag) const;
+
+	// 특정 태그를 가진 액션을 인덱스로 조회 (복사 없음)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|DB")
+	URogueliteActionData* GetActionByTagAt(FGameplayTag Tag, int32 Index) const;
+
+	// 등록된 모든 액션 (C++ 전용, 복사 없음)
+	const TSet<URogueliteActionData*>& GetActionsRef() const { return AllActions; }
+
+	// 특정 태그를 가진 액션 (C++ 전용, 복사 없음)
+	const TSet<URogueliteActionData*>& GetActionsByTagRef(FGameplayTag Tag) const;
+
 	/*~ Run Management ~*/
 
-	// 런 시작
+	// 런 시작 (Seed = 0이면 새 시드 생성)
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Run")
-	void StartRun();
+	void StartRun(int32 Seed = 0);
 
 	// 런 종료
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Run")
@@ -80,19 +165,72 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Run")
 	bool IsRunActive() const;
 
-	// RunState 직접 접근
+	// 분류별 변경 버전 (이전 값과 같으면 해당 데이터 재구성 생략 가능)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Run")
+	int32 GetChangeVersion(ERogueliteChangeCategory Category) const;
+
+	// RunState 읽기 전용 접근
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Run")
-	FRogueliteRunState& GetRunState();
+	const FRogueliteRunState& GetRunState() const;
 
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Run")
 	const FRogueliteRunState& GetRunStateConst() const;
 
+	// 현재 런 시드
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Run")
+	int32 GetRunSeed() const;
+
+	// 런을 시작(복원 포함)할 때마다 증가 (같은 시드로 다시 시작해도 값이 달라짐)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Run")
+	int32 GetRunStartCount() const;
+
+	/*~ Snapshot ~*/
+
+	// 최신 RunState 읽기 전용 스냅샷 (어느 스레드에서든 호출 가능, 게임 스레드에서는 미게시 변경을 즉시 게시)
+	FRogueliteRunStateSnapshotPtr GetRunStateSnapshot();
+
+	// RunState 변경 버전 (값이 같으면 내용도 같음)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Run")
+	int32 GetRunStateVersion() const;
+
+	// RunState 직접 수정 (수정 후 인덱스 재구성 및 변경 표시)
+	void MutateRunState(TFunctionRef<void(FRogueliteRunState&)> Mutator);
+
+	// 인덱스 재구성 및 전체 분류 변경 표시
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Run")
+	void MarkRunStateDirty();
+
 	/*~ Query ~*/
 
 	// 쿼리 실행
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Query")
 	TArray<URogueliteActionData*> ExecuteQuery(const FRogueliteQuery& InQuery);
 
+	// 호출자 버퍼에 쿼리 결과 기록 (워밍업 이후 힙 할당 없음, 버퍼 크기를 넘는 결과는 버림). 기록한 수 반환
+	int32 ExecuteQueryInto(const FRogueliteQuery& InQuery, TArrayView<URogueliteActionData*> OutResults);
+
+	// 호출자 배열(인라인 할당자 포함)에 쿼리 결과 기록
+	template <typename AllocatorType>
+	void ExecuteQueryInto(const FRogueliteQuery& InQuery, TArray<URogueliteActionData*, AllocatorType>& OutResults)
+	{
+		const TConstArrayView<URogueliteActionData*> Results = RunQuery(InQuery);
+		OutResults.Reset(Results.Num());
+		OutResults.Append(Results.GetData(), Results.Num());
+		BroadcastQueryComplete(InQuery, OutResults);
+	}
+
+	// explain 모드로 쿼리 실행 (단계별 탈락 수/시간 리포트 반환)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Query")
+	TArray<URogueliteActionData*> ExecuteQueryWithReport(const FRogueliteQuery& InQuery, FRogueliteQueryReport& OutReport);
+
+	// 마지막 explain 쿼리 리포트 (디버그 위젯/콘솔용)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Query")
+	const FRogueliteQueryReport& GetLastQueryReport() const;
+
+	// 쿼리 임시 버퍼가 커진 횟수 (워밍업 이후 증가하면 정상 상태 쿼리가 할당 중)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Query")
+	int32 GetQueryScratchGrowthCount() const;
+
 	// 프리셋으로 간편 쿼리
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Query")
 	TArray<URogueliteActionData*> QuerySimple(URoguelitePoolPreset* Preset, int32 Count = 3);
@@ -101,6 +239,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Query")
 	TArray<URogueliteActionData*> QueryByTag(FGameplayTag PoolTag, int32 Count = 3);
 
+	// 가중치 풀에서 Count개 추첨 (런 랜덤 스트림 사용, 결과는 항목 인덱스)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Query")
+	TArray<int32> DrawFromWeightedPool(const FRogueliteWeightedPool& Pool, FGameplayTag StreamKey, int32 Count = 1, bool bUnique = false);
+
+	// 빌드되지 않은 풀을 대신 빌드해 캐시한 수
+	int32 GetCachedWeightedPoolCount() const { return BuiltPoolCache.Num(); }
+
 	/*~ Action Management ~*/
 
 	// 액션 획득
@@ -131,16 +276,45 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Action")
 	TArray<URogueliteActionData*> GetAcquiredWithTag(FGameplayTag Tag) const;
 
+	// 태그를 가진 획득 액션 수 (부모 태그 매칭)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Action")
+	int32 GetAcquiredCountWithTag(FGameplayTag Tag) const;
+
+	// 태그를 가진 획득 액션의 스택 합계 (부모 태그 매칭)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Action")
+	int32 GetAcquiredStacksWithTag(FGameplayTag Tag) const;
+
+	// 태그를 가진 획득 액션 (C++ 전용, 복사 없음)
+	const TArray<URogueliteActionData*>& GetAcquiredWithTagRef(FGameplayTag Tag) const { return RunState.GetAcquiredWithTag(Tag); }
+
+	// 획득 액션 수
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Action")
+	int32 GetAcquiredCount() const;
+
+	// 인덱스로 획득 액션 조회 (복사 없음)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Action")
+	URogueliteActionData* GetAcquiredAt(int32 Index) const;
+
+	// 획득 액션과 정보 (C++ 전용, 복사 없음)
+	const TMap<URogueliteActionData*, FRogueliteAcquiredInfo>& GetAcquiredActionsRef() const { return RunState.AcquiredActions; }
+
+	// 획득 액션 배열 (C++ 전용, Acquired 버전이 바뀔 때만 재구성)
+	const TArray<URogueliteActionData*>& GetAcquiredArrayRef() const;
+
 	/*~ Tags ~*/
 
-	// 태그 추가
+	// 태그 참조 추가 (처음 추가될 때만 활성화)
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Tags")
 	void AddTagToSystem(FGameplayTag Tag);
 
-	// 태그 제거
+	// AddTagToSystem으로 추가한 참조 해제 (추가한 횟수만큼 해제해야 비활성화, 액션이 부여한 참조는 유지)
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Tags")
 	void RemoveTagFromSystem(FGameplayTag Tag);
 
+	// 태그 참조 수 (액션 자동 부여 + 수동 추가)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Tags")
+	int32 GetTagRefCount(FGameplayTag Tag) const;
+
 	// 태그 보유 여부
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Tags")
 	bool HasTagInSystem(FGameplayTag Tag) const;
@@ -167,6 +341,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Numeric")
 	TMap<FGameplayTag, float> GetAllRunStateValues() const;
 
+	// 수치 항목 수
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Numeric")
+	int32 GetRunStateValueCount() const;
+
+	// 인덱스로 수치 항목 조회 (복사 없음)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Numeric")
+	bool GetRunStateValueAt(int32 Index, FGameplayTag& OutKey, float& OutValue) const;
+
+	// 모든 수치 (C++ 전용, 복사 없음)
+	const TMap<FGameplayTag, float>& GetRunStateValuesRef() const;
+
 	/*~ Slots ~*/
 
 	// 슬롯에 장착
@@ -181,6 +366,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Slots")
 	TArray<URogueliteActionData*> GetSlotContents(FGameplayTag SlotTag) const;
 
+	// 인덱스로 슬롯 액션 조회 (복사 없음)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Slots")
+	URogueliteActionData* GetSlotActionAt(FGameplayTag SlotTag, int32 Index) const;
+
+	// 슬롯 내용 (C++ 전용, 복사 없음)
+	const TArray<URogueliteActionData*>& GetSlotContentsRef(FGameplayTag SlotTag) const;
+
 	// 슬롯 사용 개수
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Slots")
 	int32 GetSlotCount(FGameplayTag SlotTag) const;
@@ -199,6 +391,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Roguelite|Save")
 	void RestoreRunFromSaveData(const FRogueliteRunSaveData& SaveData);
 
+	/*~ Replay ~*/
+
+	// 리플레이 로그로 런 재현 (렌더링 없이 즉시 빨리 감기, 이후 같은 로그에 이어서 기록. 불일치 시 런 종료)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Replay")
+	bool ReplayRunFromLog(const FString& FilePath, FString& OutFailReason);
+
+	// 현재 기록 중인 리플레이 로그 경로 (기록 중이 아니면 빈 문자열)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|Replay")
+	FString GetReplayLogPath() const;
+
 	/*~ Pre-Acquire Check ~*/
 
 	// 획득 전 체크 등록
@@ -236,23 +438,48 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Roguelite|Events")
 	FRogueliteQueryCompleteSignature OnQueryComplete;
 
+	// 쿼리 완료 이벤트 (C++ 전용, 결과 복사 없음)
+	FRogueliteQueryCompleteNativeSignature OnQueryCompleteNative;
+
 	// 수치 데이터 변경 이벤트
 	UPROPERTY(BlueprintAssignable, Category = "Roguelite|Events")
 	FRogueliteValueChangedSignature OnRunStateValueChanged;
 
+	// 활성 태그 추가/제거 이벤트 (참조 수 0 <-> 1 전환 시에만)
+	UPROPERTY(BlueprintAssignable, Category = "Roguelite|Events")
+	FRogueliteTagChangedSignature OnActiveTagChanged;
+
 protected:
 	// 쿼리 모드에 따른 필터링
 	bool PassesQueryMode(URogueliteActionData* Action, ERogueliteQueryMode Mode) const;
 
+	// 쿼리 실행 본체 (결과는 임시 버퍼를 가리키므로 다음 쿼리 전까지만 유효, 이벤트는 발생하지 않음)
+	TConstArrayView<URogueliteActionData*> RunQuery(const FRogueliteQuery& InQuery);
+
+	// 쿼리 완료 이벤트 발생 (결과를 호출자 버퍼로 옮긴 뒤 호출)
+	void BroadcastQueryComplete(const FRogueliteQuery& InQuery, TConstArrayView<URogueliteActionData*> Results);
+
 	// 가중치 기반 선택
-	TArray<URogueliteActionData*> WeightedSelect(const TArray<URogueliteActionData*>& Candidates, const FRogueliteQuery& InQuery);
+	void WeightedSelect(const TArray<URogueliteActionData*>& Candidates, const FRogueliteQuery& InQuery, FRandomStream& RandomStream, FRogueliteQueryScratch& Scratch, TArray<URogueliteActionData*>& OutResults);
 
-	// 자동 효과 적용
+	// 자동 효과 적용 (스택 반영 후 호출)
 	void ApplyAutoEffects(URogueliteActionData* Action, int32 Stacks);
 
-	// 자동 효과 제거
+	// 자동 효과 제거 (스택 반영 전 호출)
 	void RemoveAutoEffects(URogueliteActionData* Action, int32 Stacks);
 
+	// 태그 참조 추가 후 활성화 전환 시 알림
+	void AddTagRef(FGameplayTag Tag);
+
+	// 태그 참조 해제 후 비활성화 전환 시 알림
+	void RemoveTagRef(FGameplayTag Tag);
+
+	// 수동 태그 추가/해제 리플레이 기록
+	void AppendTagReplayEvent(ERogueliteReplayEventType Type, FGameplayTag Tag);
+
+	// 수치 변경 리플레이 기록
+	void AppendValueReplayEvent(FGameplayTag Key, float Value);
+
 private:
 	/*~ ActionDB ~*/
 
@@ -260,6 +487,39 @@ private:
 	UPROPERTY()
 	TSet<URogueliteActionData*> AllActions;
 
+	/*~ Query Explain ~*/
+
+	// 마지막 explain 쿼리 리포트
+	FRogueliteQueryReport LastQueryReport;
+
+	/*~ Query Scratch ~*/
+
+	// 쿼리 임시 버퍼 (쿼리 간 재사용)
+	FRogueliteQueryScratch QueryScratch;
+
+	// 쿼리 중 다시 호출된 쿼리용 임시 버퍼 (커스텀 필터 등에서 재진입, 깊이 1부터)
+	TArray<TUniquePtr<FRogueliteQueryScratch>> NestedQueryScratch;
+
+	// 현재 실행 중인 쿼리 깊이
+	int32 QueryDepth = 0;
+
+	// 임시 버퍼 증가 횟수
+	int32 QueryScratchGrowthCount = 0;
+
+	/*~ Weighted Pool Cache ~*/
+
+	// Build 없이 넘어온 풀 → 빌드된 풀 (내용 해시 키, BP 구조체는 값으로 넘어와 에셋 식별자가 없음)
+	TMap<uint32, FRogueliteWeightedPool> BuiltPoolCache;
+
+	// DrawFromWeightedPool 중복 없는 추첨 버퍼
+	FRogueliteWeightedDrawScratch PoolDrawScratch;
+
+	// 캐시 최대 항목 수 (넘으면 비움)
+	static constexpr int32 MaxBuiltPoolCacheSize = 64;
+
+	// 캐시에서 빌드된 풀을 찾거나 빌드해 추가
+	const FRogueliteWeightedPool& FindOrBuildPool(const FRogueliteWeightedPool& Pool);
+
 	// 태그별 인덱스
 	TMap<FGameplayTag, TSet<URogueliteActionData*>> TagIndex;
 
@@ -269,8 +529,62 @@ private:
 	UPROPERTY()
 	FRogueliteRunState RunState;
 
+	// 런 시작 횟수
+	int32 RunStartCount = 0;
+
 	/*~ Pre-Acquire Checks ~*/
 
 	// 획득 전 체크 목록
 	TArray<FRoguelitePreAcquireCheckSignature> PreAcquireChecks;
+
+	/*~ Replay ~*/
+
+	// 런 리플레이 로그
+	FRogueliteReplayLog ReplayLog;
+
+	// 리플레이 재생 중 여부 (재생 중에는 새 로그를 열지 않음)
+	bool bReplaying = false;
+
+	/*~ Snapshot ~*/
+
+	// 분류별 변경 버전 증가 (ActionDB 외에는 RunState 버전도 증가)
+	void MarkChanged(ERogueliteChangeCategory Category);
+
+	// 변경된 RunState가 있으면 새 스냅샷 게시 (게임 스레드 전용)
+	void PublishRunStateSnapshot();
+
+	// 프레임마다 스냅샷 게시
+	bool TickRunStateSnapshot(float DeltaTime);
+
+	// RunState 변경 버전
+	uint32 RunStateVersion = 1;
+
+	// 마지막으로 게시한 스냅샷의 버전
+	uint32 PublishedSnapshotVersion = 0;
+
+	// 최신 스냅샷 (SnapshotLock 안에서만 읽고 교체, 읽기 측은 참조를 복사해 감)
+	FRogueliteRunStateSnapshotPtr PublishedSnapshot;
+
+	// PublishedSnapshot 보호용 잠금 (TSharedPtr 교체는 원자적이지 않으므로 참조 복사 구간만 잠금)
+	mutable FRWLock SnapshotLock;
+
+	// 스냅샷 티커 핸들
+	FTSTicker::FDelegateHandle SnapshotTickerHandle;
+
+	/*~ Change Tracking ~*/
+
+	// 분류별 변경 버전
+	uint32 ChangeVersions[static_cast<int32>(ERogueliteChangeCategory::MAX)] = {};
+
+	// 인덱스 접근용 획득 액션 배열 캐시
+	mutable TArray<URogueliteActionData*> AcquiredArrayCache;
+
+	// 획득 액션 캐시가 반영한 Acquired 버전
+	mutable uint32 AcquiredArrayCacheVersion = MAX_uint32;
+
+	// 인덱스 접근용 수치 키 캐시
+	mutable TArray<FGameplayTag> NumericKeyCache;
+
+	// 수치 키 캐시가 반영한 Numeric 버전
+	mutable uint32 NumericKeyCacheVersion = MAX_uint32;
 };
@@ -40,6 +40,23 @@ enum class ERogueliteQueryMode : uint8
 	Custom
 };
 
+UENUM(BlueprintType)
+enum class ERogueliteChangeCategory : uint8
+{
+	// 등록된 액션 DB
+	ActionDB,
+	// 획득 액션 및 스택
+	Acquired,
+	// 슬롯 장착 상태
+	Slots,
+	// 활성 태그
+	Tags,
+	// 수치 데이터
+	Numeric,
+
+	MAX UMETA(Hidden)
+};
+
 /*~ Value Entry ~*/
 
 USTRUCT(BlueprintType)
@@ -121,10 +138,32 @@ struct ROGUELITECORE_API FRogueliteRunState
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	FGameplayTagContainer ActiveTags;
 
+	// 활성 태그별 참조 수 (0이 되면 ActiveTags에서 제거)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TMap<FGameplayTag, int32> TagRefCounts;
+
+	// AddTagToSystem으로 부여한 참조 수 (액션 자동 부여분은 포함하지 않음)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TMap<FGameplayTag, int32> SystemTagCounts;
+
 	// 태그 키 기반 수치 데이터
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	TMap<FGameplayTag, float> NumericData;
 
+	// 런 시드 (모든 하위 랜덤 스트림의 기준)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int32 RandomSeed = 0;
+
+	// 스트림 키(풀 태그)별 랜덤 스트림
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TMap<FGameplayTag, FRandomStream> RandomStreams;
+
+	// 태그별 획득 액션 (부모 태그 포함, 획득 순서 유지)
+	TMap<FGameplayTag, TArray<URogueliteActionData*>> AcquiredTagIndex;
+
+	// 태그별 획득 스택 합계 (부모 태그 포함)
+	TMap<FGameplayTag, int32> AcquiredTagStacks;
+
 	// 상태 초기화
 	void Reset()
 	{
@@ -132,7 +171,13 @@ struct ROGUELITECORE_API FRogueliteRunState
 		AcquiredActions.Empty();
 		Slots.Empty();
 		ActiveTags.Reset();
+		TagRefCounts.Empty();
+		SystemTagCounts.Empty();
 		NumericData.Empty();
+		RandomSeed = 0;
+		RandomStreams.Empty();
+		AcquiredTagIndex.Empty();
+		AcquiredTagStacks.Empty();
 	}
 
 	// 액션 보유 여부 확인
@@ -151,6 +196,51 @@ struct ROGUELITECORE_API FRogueliteRunState
 		return 0;
 	}
 
+	// 스택 수 설정 (0이면 제거, 태그 인덱스 동기화)
+	void SetStacks(URogueliteActionData* Action, int32 NewStacks);
+
+	// AcquiredActions를 직접 수정한 뒤 태그 인덱스 재구성
+	void RebuildAcquiredTagIndex();
+
+	// 태그를 가진 획득 액션 (복사 없음)
+	const TArray<URogueliteActionData*>& GetAcquiredWithTag(FGameplayTag Tag) const;
+
+	// 태그를 가진 획득 액션 수
+	int32 GetAcquiredCountWithTag(FGameplayTag Tag) const
+	{
+		return GetAcquiredWithTag(Tag).Num();
+	}
+
+	// 태그를 가진 획득 액션의 스택 합계
+	int32 GetAcquiredStacksWithTag(FGameplayTag Tag) const
+	{
+		if (const int32* Stacks = AcquiredTagStacks.Find(Tag))
+		{
+			return *Stacks;
+		}
+		return 0;
+	}
+
+	// 태그 참조 추가 (0 -> 1이면 ActiveTags에 추가하고 true)
+	bool AddTagRef(FGameplayTag Tag);
+
+	// 태그 참조 해제 (1 -> 0이면 ActiveTags에서 제거하고 true)
+	bool RemoveTagRef(FGameplayTag Tag);
+
+	// 태그 참조 수
+	int32 GetTagRefCount(FGameplayTag Tag) const
+	{
+		if (const int32* Count = TagRefCounts.Find(Tag))
+		{
+			return *Count;
+		}
+		return 0;
+	}
+
+	// 획득 액션의 자동 부여분과 시스템 부여분으로 참조 수와 ActiveTags 재계산
+	// 출처 없이 ActiveTags에 들어 있는 태그는 시스템 부여 1회로 간주
+	void RecomputeTagRefCounts();
+
 	// 수치 데이터 조회
 	float GetNumericValue(FGameplayTag Key, float DefaultValue = 0.f) const
 	{
@@ -195,8 +285,43 @@ struct ROGUELITECORE_API FRogueliteRunState
 		SetNumericValue(Key, NewValue);
 		return NewValue;
 	}
+
+	// 런 시드와 스트림 키로 하위 스트림 시드 계산 (FName 인덱스가 아닌 문자열 기준이라 프로세스 간 동일)
+	int32 DeriveStreamSeed(FGameplayTag StreamKey) const
+	{
+		const uint32 KeyHash = FCrc::StrCrc32(*StreamKey.ToString());
+		return static_cast<int32>(HashCombine(static_cast<uint32>(RandomSeed), KeyHash));
+	}
+
+	// 스트림 키의 랜덤 스트림 반환 (없으면 런 시드에서 파생해 생성)
+	FRandomStream& GetRandomStream(FGameplayTag StreamKey)
+	{
+		if (FRandomStream* Stream = RandomStreams.Find(StreamKey))
+		{
+			return *Stream;
+		}
+		return RandomStreams.Add(StreamKey, FRandomStream(DeriveStreamSeed(StreamKey)));
+	}
+};
+
+/*~ Run State Snapshot ~*/
+
+/**
+ * 게시 시점 RunState의 불변 사본.
+ * UI 갱신 판단, 텔레메트리, 비동기 쿼리 등 게임 스레드 밖에서 잠금 없이 읽기용.
+ * 액션 포인터의 수명은 ActionDB 등록이 보장하므로 스냅샷은 참조만 보관.
+ */
+struct ROGUELITECORE_API FRogueliteRunStateSnapshot
+{
+	// 스냅샷이 반영한 RunState 버전
+	uint32 Version = 0;
+
+	// RunState 사본
+	FRogueliteRunState State;
 };
 
+using FRogueliteRunStateSnapshotPtr = TSharedPtr<const FRogueliteRunStateSnapshot, ESPMode::ThreadSafe>;
+
 /*~ Query ~*/
 
 USTRUCT(BlueprintType)
@@ -216,10 +341,14 @@ struct ROGUELITECORE_API FRogueliteQuery
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	int32 Count = 3;
 
-	// 가중치 선택용 랜덤 시드 (0 = 무작위)
+	// 가중치 선택용 랜덤 시드 (0 = 런 랜덤 스트림 사용)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	int32 RandomSeed = 0;
 
+	// 사용할 런 랜덤 스트림 키 (비어 있으면 첫 번째 풀 태그)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FGameplayTag RandomStreamTag;
+
 	// 필수 태그
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	FGameplayTagContainer RequireTags;
@@ -243,6 +372,10 @@ struct ROGUELITECORE_API FRogueliteQuery
 	// 커스텀 필터 (Mode=Custom 또는 추가 조건)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Instanced)
 	URogueliteQueryFilter* CustomFilter = nullptr;
+
+	// 단계별 탈락 수/시간 리포트 수집 (GetLastQueryReport로 확인)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bExplain = false;
 };
 
 /*~ Run Save Data ~*/
@@ -264,6 +397,10 @@ struct ROGUELITECORE_API FRogueliteRunSaveData
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	FGameplayTagContainer ActiveTags;
 
+	// AddTagToSystem으로 부여한 참조 수 (액션 부여분은 복원 시 재계산, 비어 있으면 출처 없는 태그를 1로 복원)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TMap<FGameplayTag, int32> SystemTagCounts;
+
 	// 수치 데이터
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	TMap<FGameplayTag, float> NumericData;
@@ -272,6 +409,10 @@ struct ROGUELITECORE_API FRogueliteRunSaveData
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	int32 RandomSeed = 0;
 
+	// 스트림 키별 현재 랜덤 스트림 상태
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TMap<FGameplayTag, int32> RandomStreamStates;
+
 	// 총 플레이 시간 (초)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	float PlayTime = 0.f;
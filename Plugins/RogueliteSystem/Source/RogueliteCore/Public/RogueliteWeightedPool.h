@@ -0,0 +1,110 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "RogueliteWeightedPool.generated.h"
+
+/*~ Weighted Pool ~*/
+
+USTRUCT(BlueprintType)
+struct ROGUELITECORE_API FRogueliteWeightedEntry
+{
+	GENERATED_BODY()
+
+	// 기본 가중치
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weighted Pool", meta = (ClampMin = "0.0"))
+	float Weight = 1.0f;
+
+	// 태그 조건 배율 판정용 태그
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weighted Pool")
+	FGameplayTagContainer Tags;
+};
+
+/**
+ * DrawUnique 임시 버퍼.
+ * 풀과 분리되어 있어 같은 풀을 여러 호출자가 각자 버퍼로 동시에 추첨 가능. 추첨 간 재사용하면 할당 없음.
+ */
+struct FRogueliteWeightedDrawScratch
+{
+	// 아직 선택되지 않은 항목 인덱스
+	TArray<int32> Remaining;
+
+	// 남은 항목 기준 누적 가중치
+	TArray<float> RemainingCumulative;
+
+	// 확보된 메모리 (바이트)
+	SIZE_T GetAllocatedSize() const { return Remaining.GetAllocatedSize() + RemainingCumulative.GetAllocatedSize(); }
+};
+
+/**
+ * 가중치 추첨 풀.
+ * Build()로 누적 가중치 테이블을 한 번 계산한 뒤 이진 탐색으로 추첨. 결과는 항목 인덱스.
+ */
+USTRUCT(BlueprintType)
+struct ROGUELITECORE_API FRogueliteWeightedPool
+{
+	GENERATED_BODY()
+
+	// 풀 항목
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weighted Pool")
+	TArray<FRogueliteWeightedEntry> Entries;
+
+	// 태그별 가중치 배율 (항목이 태그를 가지면 곱함)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weighted Pool")
+	TMap<FGameplayTag, float> WeightModifiers;
+
+	// Entries + WeightModifiers로 누적 테이블 계산
+	void Build();
+
+	// 이미 계산된 가중치로 누적 테이블 계산 (Entries 미사용)
+	void BuildFromWeights(TArray<float>&& InWeights);
+
+	// 가중치를 복사해 누적 테이블 계산 (기존 용량 재사용)
+	void BuildFromWeights(TConstArrayView<float> InWeights);
+
+	// 누적 테이블 계산 여부
+	bool IsBuilt() const { return Cumulative.Num() > 0 && Cumulative.Num() == Weights.Num(); }
+
+	// 추첨 가능한 항목 수
+	int32 Num() const { return Cumulative.Num(); }
+
+	// 전체 가중치 합
+	float GetTotalWeight() const { return Cumulative.Num() > 0 ? Cumulative.Last() : 0.f; }
+
+	// 1개 추첨 (중복 허용, 모든 가중치가 0이면 균등)
+	int32 Draw(FRandomStream& RandomStream) const;
+
+	// Count개 추첨 (중복 허용)
+	void DrawMany(FRandomStream& RandomStream, int32 Count, TArray<int32>& OutIndices) const;
+
+	// 호출자 버퍼 크기만큼 추첨 (중복 허용). 기록한 수 반환
+	int32 DrawMany(FRandomStream& RandomStream, TArrayView<int32> OutIndices) const;
+
+	// Count개 추첨 (중복 없음). Scratch가 없으면 지역 버퍼 사용
+	void DrawUnique(FRandomStream& RandomStream, int32 Count, TArray<int32>& OutIndices, FRogueliteWeightedDrawScratch* Scratch = nullptr) const;
+
+	// 호출자 버퍼 크기만큼 추첨 (중복 없음, 항목 수를 넘지 않음). 기록한 수 반환
+	int32 DrawUnique(FRandomStream& RandomStream, TArrayView<int32> OutIndices, FRogueliteWeightedDrawScratch* Scratch = nullptr) const;
+
+	// 태그 조건 배율 적용
+	static float ApplyWeightModifiers(float Weight, const FGameplayTagContainer& Tags, const TMap<FGameplayTag, float>& Modifiers);
+
+	// Entries + WeightModifiers 해시 (빌드된 풀 캐시 키)
+	uint32 GetContentHash() const;
+
+	// Entries + WeightModifiers가 같은지 (캐시 해시 충돌 확인용)
+	bool HasSameContent(const FRogueliteWeightedPool& Other) const;
+
+	// 확보된 메모리 (바이트, Entries/WeightModifiers 제외)
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	// Weights로 누적 테이블 계산
+	void BuildCumulative();
+
+	// 배율 적용된 항목별 가중치
+	TArray<float> Weights;
+
+	// 누적 가중치 (Cumulative[i] = Weights[0..i] 합)
+	TArray<float> Cumulative;
+};
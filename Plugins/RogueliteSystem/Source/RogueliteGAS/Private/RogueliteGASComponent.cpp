@@ -0,0 +1,416 @@
+#include "RogueliteGASComponent.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "GameplayEffect.h"
+#include "RogueliteGASActionData.h"
+#include "RogueliteSubsystem.h"
+
+URogueliteGASComponent::URogueliteGASComponent()
+{
+	// 더티 값이 있을 때만 틱
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+/*~ UActorComponent Interface ~*/
+
+void URogueliteGASComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	RebuildBindingIndex();
+
+	if (!IsValid(AbilitySystemComponent))
+	{
+		AbilitySystemComponent = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetOwner());
+	}
+
+	RogueliteSubsystem = URogueliteSubsystem::Get(this);
+	if (IsValid(RogueliteSubsystem))
+	{
+		RogueliteSubsystem->OnRunStateValueChanged.AddDynamic(this, &URogueliteGASComponent::HandleRunStateValueChanged);
+		RogueliteSubsystem->OnRunStarted.AddDynamic(this, &URogueliteGASComponent::HandleRunStarted);
+		RogueliteSubsystem->OnStackChanged.AddDynamic(this, &URogueliteGASComponent::HandleStackChanged);
+	}
+
+	if (bApplyOnRunStart)
+	{
+		MarkAllBindingsDirty();
+	}
+
+	// 이미 획득한 액션 반영
+	SyncGrantedActions();
+}
+
+void URogueliteGASComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (IsValid(RogueliteSubsystem))
+	{
+		RogueliteSubsystem->OnRunStateValueChanged.RemoveDynamic(this, &URogueliteGASComponent::HandleRunStateValueChanged);
+		RogueliteSubsystem->OnRunStarted.RemoveDynamic(this, &URogueliteGASComponent::HandleRunStarted);
+		RogueliteSubsystem->OnStackChanged.RemoveDynamic(this, &URogueliteGASComponent::HandleStackChanged);
+	}
+	RogueliteSubsystem = nullptr;
+
+	RemoveAllGrants();
+	SpecCache.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void URogueliteGASComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	FlushPendingValues();
+}
+
+/*~ Binding ~*/
+
+void URogueliteGASComponent::MarkAllBindingsDirty()
+{
+	for (int32 i = 0; i < AttributeBindings.Num() && i < 64; ++i)
+	{
+		MarkBindingDirty(i);
+	}
+}
+
+void URogueliteGASComponent::FlushPendingValues()
+{
+	SetComponentTickEnabled(false);
+
+	// 적용 대상이 없으면 마스크는 남겨 두고 ASC 지정이나 다음 변경 때 다시 틱
+	if (DirtyMask == 0 || !IsValid(AbilitySystemComponent) || !IsValid(RogueliteSubsystem))
+	{
+		return;
+	}
+
+	const uint64 MaskToApply = DirtyMask;
+	DirtyMask = 0;
+
+	UGameplayEffect* BatchEffect = GetOrCreateBatchEffect(MaskToApply);
+	if (!IsValid(BatchEffect))
+	{
+		return;
+	}
+
+	// 프레임 중 여러 번 바뀌었어도 최종 값만 한 번 적용
+	FGameplayEffectSpec Spec(BatchEffect, AbilitySystemComponent->MakeEffectContext(), 1.f);
+	for (int32 i = 0; i < AttributeBindings.Num() && i < 64; ++i)
+	{
+		if (MaskToApply & (1ull << i))
+		{
+			const FGameplayTag& Key = AttributeBindings[i].Key;
+			Spec.SetSetByCallerMagnitude(Key, RogueliteSubsystem->GetRunStateValue(Key, AbilitySystemComponent->GetNumericAttributeBase(AttributeBindings[i].Attribute)));
+		}
+	}
+
+	AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(Spec);
+}
+
+void URogueliteGASComponent::SetAbilitySystemComponent(UAbilitySystemComponent* InAbilitySystemComponent)
+{
+	if (AbilitySystemComponent == InAbilitySystemComponent)
+	{
+		return;
+	}
+
+	// 이전 ASC에 부여한 것은 회수하고 스펙은 새 ASC 기준으로 다시 생성
+	RemoveAllGrants();
+	SpecCache.Reset();
+
+	AbilitySystemComponent = InAbilitySystemComponent;
+	MarkAllBindingsDirty();
+	SyncGrantedActions();
+}
+
+void URogueliteGASComponent::HandleRunStateValueChanged(FGameplayTag Key, float OldValue, float NewValue)
+{
+	if (const int32* BindingIndex = BindingIndexByKey.Find(Key))
+	{
+		MarkBindingDirty(*BindingIndex);
+	}
+}
+
+void URogueliteGASComponent::HandleRunStarted()
+{
+	if (bApplyOnRunStart)
+	{
+		MarkAllBindingsDirty();
+	}
+
+	// 새 런은 획득 목록이 비어 있으므로 이전 런 부여분 정리
+	SyncGrantedActions();
+}
+
+/*~ Action Grant ~*/
+
+void URogueliteGASComponent::SyncGrantedActions()
+{
+	if (!bGrantActionEffects || !IsValid(RogueliteSubsystem))
+	{
+		return;
+	}
+
+	const TMap<URogueliteActionData*, FRogueliteAcquiredInfo>& Acquired = RogueliteSubsystem->GetAcquiredActionsRef();
+
+	TArray<URogueliteGASActionData*> StaleActions;
+	for (const auto& GrantPair : Grants)
+	{
+		if (!Acquired.Contains(GrantPair.Key))
+		{
+			StaleActions.Add(GrantPair.Key);
+		}
+	}
+	for (URogueliteGASActionData* Action : StaleActions)
+	{
+		SetGrantedStacks(Action, 0);
+	}
+
+	for (const auto& Pair : Acquired)
+	{
+		if (URogueliteGASActionData* GASAction = Cast<URogueliteGASActionData>(Pair.Key))
+		{
+			SetGrantedStacks(GASAction, Pair.Value.Stacks);
+		}
+	}
+}
+
+void URogueliteGASComponent::RemoveAllGrants()
+{
+	TArray<URogueliteGASActionData*> GrantedActions;
+	Grants.GetKeys(GrantedActions);
+	for (URogueliteGASActionData* Action : GrantedActions)
+	{
+		SetGrantedStacks(Action, 0);
+	}
+	Grants.Reset();
+}
+
+void URogueliteGASComponent::HandleStackChanged(URogueliteActionData* Action, int32 OldStacks, int32 NewStacks)
+{
+	if (!bGrantActionEffects)
+	{
+		return;
+	}
+
+	if (URogueliteGASActionData* GASAction = Cast<URogueliteGASActionData>(Action))
+	{
+		SetGrantedStacks(GASAction, NewStacks);
+	}
+}
+
+void URogueliteGASComponent::SetGrantedStacks(URogueliteGASActionData* Action, int32 NewStacks)
+{
+	if (!IsValid(Action))
+	{
+		return;
+	}
+
+	// ASC가 없거나 권한이 없으면 추적만 정리
+	if (!IsValid(AbilitySystemComponent) || !AbilitySystemComponent->IsOwnerActorAuthoritative())
+	{
+		Grants.Remove(Action);
+		return;
+	}
+
+	NewStacks = FMath::Max(NewStacks, 0);
+
+	FRogueliteGASGrant* Grant = Grants.Find(Action);
+	const int32 OldStacks = Grant ? Grant->Stacks : 0;
+	if (OldStacks == NewStacks)
+	{
+		return;
+	}
+
+	// 완전 제거
+	if (NewStacks <= 0)
+	{
+		for (const FActiveGameplayEffectHandle& Handle : Grant->EffectHandles)
+		{
+			if (Handle.IsValid())
+			{
+				AbilitySystemComponent->RemoveActiveGameplayEffect(Handle);
+			}
+		}
+		for (const FGameplayAbilitySpecHandle& Handle : Grant->AbilityHandles)
+		{
+			if (Handle.IsValid())
+			{
+				AbilitySystemComponent->ClearAbility(Handle);
+			}
+		}
+		Grants.Remove(Action);
+		return;
+	}
+
+	const bool bUseLevel = Action->StackPolicy == ERogueliteGEStackPolicy::Level;
+
+	// 첫 획득: 캐시된 스펙으로 한 번만 적용
+	if (Grant == nullptr)
+	{
+		Grant = &Grants.Add(Action);
+
+		for (int32 i = 0; i < Action->GrantedEffects.Num(); ++i)
+		{
+			FActiveGameplayEffectHandle Handle;
+			FGameplayEffectSpecHandle SpecHandle = GetCachedEffectSpec(Action, i, bUseLevel ? NewStacks : 1);
+			if (SpecHandle.IsValid())
+			{
+				if (bUseLevel)
+				{
+					Handle = AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data);
+				}
+				else
+				{
+					FGameplayEffectSpec StackedSpec(*SpecHandle.Data);
+					StackedSpec.SetStackCount(NewStacks);
+					Handle = AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(StackedSpec);
+				}
+			}
+			Grant->EffectHandles.Add(Handle);
+		}
+
+		for (const TSubclassOf<UGameplayAbility>& AbilityClass : Action->GrantedAbilities)
+		{
+			FGameplayAbilitySpecHandle Handle;
+			if (AbilityClass)
+			{
+				Handle = AbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(AbilityClass, NewStacks, INDEX_NONE, Action));
+			}
+			Grant->AbilityHandles.Add(Handle);
+		}
+
+		Grant->Stacks = NewStacks;
+		return;
+	}
+
+	// 스택 변경: 활성 GE를 재적용하지 않고 레벨/스택 수만 조정
+	for (int32 i = 0; i < Grant->EffectHandles.Num(); ++i)
+	{
+		const FActiveGameplayEffectHandle& Handle = Grant->EffectHandles[i];
+		if (!Handle.IsValid())
+		{
+			continue;
+		}
+
+		if (bUseLevel)
+		{
+			AbilitySystemComponent->SetActiveGameplayEffectLevel(Handle, NewStacks);
+		}
+		else if (NewStacks > OldStacks)
+		{
+			// Aggregate 스택 GE는 같은 핸들에 스택이 합쳐짐
+			FGameplayEffectSpecHandle SpecHandle = GetCachedEffectSpec(Action, i, 1);
+			if (SpecHandle.IsValid())
+			{
+				FGameplayEffectSpec StackedSpec(*SpecHandle.Data);
+				StackedSpec.SetStackCount(NewStacks - OldStacks);
+				AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(StackedSpec);
+			}
+		}
+		else
+		{
+			AbilitySystemComponent->RemoveActiveGameplayEffect(Handle, OldStacks - NewStacks);
+		}
+	}
+
+	for (const FGameplayAbilitySpecHandle& Handle : Grant->AbilityHandles)
+	{
+		if (FGameplayAbilitySpec* AbilitySpec = AbilitySystemComponent->FindAbilitySpecFromHandle(Handle))
+		{
+			AbilitySpec->Level = NewStacks;
+			AbilitySystemComponent->MarkAbilitySpecDirty(*AbilitySpec);
+		}
+	}
+
+	Grant->Stacks = NewStacks;
+}
+
+FGameplayEffectSpecHandle URogueliteGASComponent::GetCachedEffectSpec(URogueliteGASActionData* Action, int32 EffectIndex, int32 Level)
+{
+	const TTuple<const URogueliteGASActionData*, int32, int32> Key(Action, EffectIndex, Level);
+	if (const FGameplayEffectSpecHandle* Found = SpecCache.Find(Key))
+	{
+		return *Found;
+	}
+
+	FGameplayEffectSpecHandle SpecHandle;
+	const TSubclassOf<UGameplayEffect>& EffectClass = Action->GrantedEffects[EffectIndex];
+	if (EffectClass && IsValid(AbilitySystemComponent))
+	{
+		FGameplayEffectContextHandle Context = AbilitySystemComponent->MakeEffectContext();
+		Context.AddSourceObject(Action);
+
+		SpecHandle = AbilitySystemComponent->MakeOutgoingSpec(EffectClass, Level, Context);
+		if (SpecHandle.IsValid() && Action->bPassValuesAsSetByCaller)
+		{
+			for (const FRogueliteValueEntry& Entry : Action->Values)
+			{
+				SpecHandle.Data->SetSetByCallerMagnitude(Entry.Key, Entry.Value);
+			}
+		}
+	}
+
+	SpecCache.Add(Key, SpecHandle);
+	return SpecHandle;
+}
+
+void URogueliteGASComponent::MarkBindingDirty(int32 BindingIndex)
+{
+	if (BindingIndex < 0 || BindingIndex >= 64)
+	{
+		return;
+	}
+
+	// 이전 Flush가 적용 대상이 없어 틱을 끈 채 마스크를 남겼을 수 있으므로 매번 틱 재개
+	DirtyMask |= (1ull << BindingIndex);
+	if (!IsComponentTickEnabled())
+	{
+		SetComponentTickEnabled(true);
+	}
+}
+
+UGameplayEffect* URogueliteGASComponent::GetOrCreateBatchEffect(uint64 InDirtyMask)
+{
+	if (TObjectPtr<UGameplayEffect>* Found = BatchEffects.Find(InDirtyMask))
+	{
+		return *Found;
+	}
+
+	// 더티 바인딩마다 SetByCaller Override 모디파이어 하나
+	UGameplayEffect* BatchEffect = NewObject<UGameplayEffect>(this, NAME_None, RF_Transient);
+	BatchEffect->DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	for (int32 i = 0; i < AttributeBindings.Num() && i < 64; ++i)
+	{
+		const FRogueliteAttributeBinding& Binding = AttributeBindings[i];
+		if (!(InDirtyMask & (1ull << i)) || !Binding.Attribute.IsValid() || !Binding.Key.IsValid())
+		{
+			continue;
+		}
+
+		FSetByCallerFloat SetByCaller;
+		SetByCaller.DataTag = Binding.Key;
+
+		FGameplayModifierInfo& Modifier = BatchEffect->Modifiers.AddDefaulted_GetRef();
+		Modifier.Attribute = Binding.Attribute;
+		Modifier.ModifierOp = EGameplayModOp::Override;
+		Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(SetByCaller);
+	}
+
+	BatchEffects.Add(InDirtyMask, BatchEffect);
+	return BatchEffect;
+}
+
+void URogueliteGASComponent::RebuildBindingIndex()
+{
+	ensureMsgf(AttributeBindings.Num() <= 64, TEXT("URogueliteGASComponent supports up to 64 attribute bindings"));
+
+	BindingIndexByKey.Reset();
+	BatchEffects.Reset();
+	for (int32 i = 0; i < AttributeBindings.Num() && i < 64; ++i)
+	{
+		BindingIndexByKey.Add(AttributeBindings[i].Key, i);
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RogueliteActionData.h"
+#include "RogueliteGASActionData.generated.h"
+
+class UGameplayEffect;
+class UGameplayAbility;
+
+/*~ Stack Policy ~*/
+
+// 액션 스택을 GE에 반영하는 방식
+UENUM(BlueprintType)
+enum class ERogueliteGEStackPolicy : uint8
+{
+	// 활성 GE 하나의 레벨 = 스택 수
+	Level,
+	// GE 스택 수 = 액션 스택 수 (GE에 Aggregate 스택 설정 필요)
+	StackCount
+};
+
+/**
+ * GAS 효과/어빌리티를 부여하는 액션 데이터.
+ * 획득하면 URogueliteGASComponent가 오너 ASC에 GE를 적용하고 어빌리티를 부여함.
+ */
+UCLASS(BlueprintType, Blueprintable)
+class ROGUELITEGAS_API URogueliteGASActionData : public URogueliteActionData
+{
+	GENERATED_BODY()
+
+public:
+	/*~ GAS ~*/
+
+	// 획득 중 유지할 GE (Infinite 권장)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GAS")
+	TArray<TSubclassOf<UGameplayEffect>> GrantedEffects;
+
+	// 획득 중 부여할 어빌리티 (레벨 = 스택 수)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GAS")
+	TArray<TSubclassOf<UGameplayAbility>> GrantedAbilities;
+
+	// 스택 반영 방식
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GAS")
+	ERogueliteGEStackPolicy StackPolicy = ERogueliteGEStackPolicy::Level;
+
+	// Values를 SetByCaller로 GE에 전달 (키 = SetByCaller 태그)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GAS")
+	bool bPassValuesAsSetByCaller = true;
+};
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameplayTagContainer.h"
+#include "AttributeSet.h"
+#include "ActiveGameplayEffectHandle.h"
+#include "GameplayAbilitySpec.h"
+#include "RogueliteGASComponent.generated.h"
+
+class UAbilitySystemComponent;
+class UGameplayEffect;
+class URogueliteActionData;
+class URogueliteGASActionData;
+class URogueliteSubsystem;
+
+/*~ Attribute Binding ~*/
+
+/**
+ * RunState 수치 키 → GAS 어트리뷰트 매핑.
+ * 키 값이 바뀌면 어트리뷰트 Base 값을 해당 값으로 덮어씀.
+ */
+USTRUCT(BlueprintType)
+struct ROGUELITEGAS_API FRogueliteAttributeBinding
+{
+	GENERATED_BODY()
+
+	// RunState 수치 키 (SetByCaller 태그로도 사용)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (Categories = "Stat"))
+	FGameplayTag Key;
+
+	// 대상 어트리뷰트
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FGameplayAttribute Attribute;
+};
+
+/*~ Action Grant ~*/
+
+// 액션 하나가 ASC에 부여한 핸들
+struct FRogueliteGASGrant
+{
+	// 반영된 스택 수
+	int32 Stacks = 0;
+
+	// 적용된 GE 핸들 (GrantedEffects 순서)
+	TArray<FActiveGameplayEffectHandle> EffectHandles;
+
+	// 부여된 어빌리티 핸들 (GrantedAbilities 순서)
+	TArray<FGameplayAbilitySpecHandle> AbilityHandles;
+};
+
+/**
+ * RunState를 오너의 AbilitySystemComponent로 전달하는 컴포넌트.
+ * - 수치: 한 프레임 동안 바뀐 값을 모아 다음 틱에 Instant GE 하나로 적용
+ * - 액션: URogueliteGASActionData의 GE/어빌리티를 획득 스택에 맞춰 부여/제거
+ */
+UCLASS(ClassGroup = (Roguelite), meta = (BlueprintSpawnableComponent))
+class ROGUELITEGAS_API URogueliteGASComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	URogueliteGASComponent();
+
+	/*~ UActorComponent Interface ~*/
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	/*~ Binding ~*/
+
+	// 모든 바인딩을 다음 틱에 다시 적용
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|GAS")
+	void MarkAllBindingsDirty();
+
+	// 대기 중인 변경을 즉시 적용
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|GAS")
+	void FlushPendingValues();
+
+	// 대상 AbilitySystemComponent 지정 (기본: 오너에서 검색)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|GAS")
+	void SetAbilitySystemComponent(UAbilitySystemComponent* InAbilitySystemComponent);
+
+	/*~ Action Grant ~*/
+
+	// 획득 목록과 부여 상태 동기화 (RestoreRunFromSaveData 이후 호출)
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|GAS")
+	void SyncGrantedActions();
+
+	// 부여한 GE/어빌리티 전부 제거
+	UFUNCTION(BlueprintCallable, Category = "Roguelite|GAS")
+	void RemoveAllGrants();
+
+public:
+	/*~ Config ~*/
+
+	// 수치 키 → 어트리뷰트 매핑 (최대 64개)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Roguelite|GAS")
+	TArray<FRogueliteAttributeBinding> AttributeBindings;
+
+	// BeginPlay/런 시작 시 현재 값을 전부 적용
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Roguelite|GAS")
+	bool bApplyOnRunStart = true;
+
+	// URogueliteGASActionData 획득 시 GE/어빌리티 부여
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Roguelite|GAS")
+	bool bGrantActionEffects = true;
+
+protected:
+	// 수치 변경 수신
+	UFUNCTION()
+	void HandleRunStateValueChanged(FGameplayTag Key, float OldValue, float NewValue);
+
+	// 런 시작 수신
+	UFUNCTION()
+	void HandleRunStarted();
+
+	// 스택 변경 수신 (획득/제거 모두)
+	UFUNCTION()
+	void HandleStackChanged(URogueliteActionData* Action, int32 OldStacks, int32 NewStacks);
+
+	// 액션의 부여 상태를 목표 스택 수에 맞춤 (0이면 전부 제거)
+	void SetGrantedStacks(URogueliteGASActionData* Action, int32 NewStacks);
+
+	// 액션/GE/레벨별로 미리 만든 스펙 (SetByCaller 포함)
+	FGameplayEffectSpecHandle GetCachedEffectSpec(URogueliteGASActionData* Action, int32 EffectIndex, int32 Level);
+
+	// 바인딩 하나를 더티로 표시하고 틱 활성화
+	void MarkBindingDirty(int32 BindingIndex);
+
+	// 더티 조합에 맞는 집계 GE (조합별로 한 번만 생성)
+	UGameplayEffect* GetOrCreateBatchEffect(uint64 DirtyMask);
+
+	// 바인딩 인덱스 캐시 재구성
+	void RebuildBindingIndex();
+
+private:
+	// 대상 ASC
+	UPROPERTY(Transient)
+	TObjectPtr<UAbilitySystemComponent> AbilitySystemComponent;
+
+	// 구독 중인 서브시스템
+	UPROPERTY(Transient)
+	TObjectPtr<URogueliteSubsystem> RogueliteSubsystem;
+
+	// 더티 조합 → 집계 GE
+	UPROPERTY(Transient)
+	TMap<uint64, TObjectPtr<UGameplayEffect>> BatchEffects;
+
+	// 키 → 바인딩 인덱스
+	TMap<FGameplayTag, int32> BindingIndexByKey;
+
+	// 적용 대기 중인 바인딩 비트
+	uint64 DirtyMask = 0;
+
+	// 액션별 부여 상태 (액션은 서브시스템의 획득 목록이 유지)
+	TMap<URogueliteGASActionData*, FRogueliteGASGrant> Grants;
+
+	// (액션, GE 인덱스, 레벨) → 스펙
+	TMap<TTuple<const URogueliteGASActionData*, int32, int32>, FGameplayEffectSpecHandle> SpecCache;
+};
@@ -10,6 +10,9 @@ public class RogueliteGAS : ModuleRules
             new string[]
             {
                 "Core",
+                "GameplayTags",
+                "GameplayAbilities",
+                "RogueliteCore"
             }
         );
 
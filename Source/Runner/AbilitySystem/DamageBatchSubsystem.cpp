@@ -0,0 +1,224 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "DamageBatchSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "Runner/RunnerGameplayTags.h"
+#include "Runner/AbilitySystem/DamageExecutionCalculation.h"
+#include "Runner/Interfaces/CombatInterface.h"
+
+void UDamageBatchSubsystem::Deinitialize()
+{
+	PendingIndexByKey.Reset();
+	PendingDamages.Reset();
+	ApplyingDamages.Reset();
+	EventIndexByActor.Reset();
+	PendingEvents.Reset();
+	DispatchingEvents.Reset();
+	CombatInterfaceByClass.Reset();
+	BatchableByEffect.Reset();
+	FallbackCriticalStreams.Reset();
+
+	Super::Deinitialize();
+}
+
+void UDamageBatchSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	FlushPendingDamage();
+	DispatchDamageEvents();
+}
+
+TStatId UDamageBatchSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDamageBatchSubsystem, STATGROUP_Tickables);
+}
+
+void UDamageBatchSubsystem::QueueDamage(UAbilitySystemComponent* TargetASC, const FGameplayEffectSpecHandle& SpecHandle)
+{
+	if (!IsValid(TargetASC) || !SpecHandle.IsValid())
+	{
+		return;
+	}
+
+	const FGameplayEffectSpec& Spec = *SpecHandle.Data;
+
+	// 합치면 모디파이어/큐/지속시간이 한 번만 적용되므로 히트마다 그대로 적용
+	if (!IsBatchableEffect(Spec.Def))
+	{
+		TargetASC->ApplyGameplayEffectSpecToSelf(Spec);
+		return;
+	}
+
+	FBatchKey Key;
+	Key.TargetASC = TargetASC;
+	Key.SourceASC = Spec.GetEffectContext().GetInstigatorAbilitySystemComponent();
+	Key.Def = Spec.Def;
+	Key.AttackPower = Spec.GetSetByCallerMagnitude(TAG_Data_AttackPower, false, 0.f);
+
+	if (const int32* Index = PendingIndexByKey.Find(Key))
+	{
+		++PendingDamages[*Index].HitCount;
+		return;
+	}
+
+	FPendingDamage& Pending = PendingDamages.AddDefaulted_GetRef();
+	Pending.TargetASC = TargetASC;
+	Pending.SpecHandle = SpecHandle;
+	Pending.HitCount = 1;
+	PendingIndexByKey.Add(Key, PendingDamages.Num() - 1);
+}
+
+void UDamageBatchSubsystem::FlushPendingDamage()
+{
+	if (PendingDamages.Num() == 0)
+	{
+		return;
+	}
+
+	// 적용 중 새로 예약되는 데미지는 다음 프레임으로
+	Swap(PendingDamages, ApplyingDamages);
+	PendingIndexByKey.Reset();
+
+	for (const FPendingDamage& Pending : ApplyingDamages)
+	{
+		UAbilitySystemComponent* TargetASC = Pending.TargetASC.Get();
+		if (!IsValid(TargetASC))
+		{
+			continue;
+		}
+
+		FGameplayEffectSpec BatchedSpec(*Pending.SpecHandle.Data);
+		BatchedSpec.SetSetByCallerMagnitude(TAG_Data_HitCount, static_cast<float>(Pending.HitCount));
+		TargetASC->ApplyGameplayEffectSpecToSelf(BatchedSpec);
+	}
+
+	ApplyingDamages.Reset();
+}
+
+void UDamageBatchSubsystem::QueueDamageEvent(AActor* Target, float Damage, float CriticalDamage, int32 HitCount, int32 CriticalCount)
+{
+	if (!IsValid(Target))
+	{
+		return;
+	}
+
+	if (const int32* Index = EventIndexByActor.Find(Target))
+	{
+		FDamageEvent& Event = PendingEvents[*Index];
+		Event.TotalDamage += Damage;
+		Event.CriticalDamage += CriticalDamage;
+		Event.HitCount += HitCount;
+		Event.CriticalCount += CriticalCount;
+		return;
+	}
+
+	FDamageEvent& Event = PendingEvents.AddDefaulted_GetRef();
+	Event.Target = Target;
+	Event.TotalDamage = Damage;
+	Event.CriticalDamage = CriticalDamage;
+	Event.HitCount = HitCount;
+	Event.CriticalCount = CriticalCount;
+	EventIndexByActor.Add(Target, PendingEvents.Num() - 1);
+}
+
+void UDamageBatchSubsystem::DispatchDamageEvents()
+{
+	if (PendingEvents.Num() == 0)
+	{
+		return;
+	}
+
+	// 이벤트 처리 중 새로 들어오는 데미지는 다음 프레임으로
+	Swap(PendingEvents, DispatchingEvents);
+	EventIndexByActor.Reset();
+
+	for (const FDamageEvent& Event : DispatchingEvents)
+	{
+		AActor* Target = Event.Target.Get();
+		if (!IsValid(Target))
+		{
+			continue;
+		}
+
+		ICombatInterface::DispatchDamageAggregated(Target, Event.TotalDamage, Event.CriticalDamage, Event.HitCount, Event.CriticalCount);
+	}
+
+	DispatchingEvents.Reset();
+}
+
+bool UDamageBatchSubsystem::ImplementsCombatInterface(const AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return false;
+	}
+
+	const UClass* ActorClass = Actor->GetClass();
+	if (const bool* bCached = CombatInterfaceByClass.Find(ActorClass))
+	{
+		return *bCached;
+	}
+
+	const bool bImplements = ActorClass->ImplementsInterface(UCombatInterface::StaticClass());
+	CombatInterfaceByClass.Add(ActorClass, bImplements);
+	return bImplements;
+}
+
+bool UDamageBatchSubsystem::IsBatchableEffect(const UGameplayEffect* Def)
+{
+	if (!IsValid(Def))
+	{
+		return false;
+	}
+
+	if (const bool* bCached = BatchableByEffect.Find(Def))
+	{
+		return *bCached;
+	}
+
+	// Data.HitCount를 반영하는 건 데미지 실행뿐이므로 그 외 효과가 있으면 합치지 않음
+	bool bBatchable = Def->DurationPolicy == EGameplayEffectDurationType::Instant
+		&& Def->Modifiers.Num() == 0
+		&& Def->GameplayCues.Num() == 0
+		&& Def->Executions.Num() > 0;
+
+	for (const FGameplayEffectExecutionDefinition& Execution : Def->Executions)
+	{
+		if (!Execution.CalculationClass || !Execution.CalculationClass->IsChildOf(UDamageExecutionCalculation::StaticClass())
+			|| Execution.CalculationModifiers.Num() > 0 || Execution.ConditionalGameplayEffects.Num() > 0)
+		{
+			bBatchable = false;
+		}
+	}
+
+	BatchableByEffect.Add(Def, bBatchable);
+	return bBatchable;
+}
+
+const FRandomStream& UDamageBatchSubsystem::GetFallbackCriticalStream(const UObject* SourceObject, int32 RunSeed, int32 RunStartCount)
+{
+	if (FallbackRunStartCount != RunStartCount)
+	{
+		FallbackCriticalStreams.Reset();
+		FallbackRunStartCount = RunStartCount;
+	}
+
+	FFallbackCriticalStream* Found = FallbackCriticalStreams.Find(SourceObject);
+	if (Found && Found->RunSeed == RunSeed)
+	{
+		return Found->Stream;
+	}
+
+	// 이름 대신 클래스 경로 + 처음 쓰인 순서로 시드 (같은 순서로 공격하면 재현됨)
+	const uint32 ClassHash = SourceObject ? FCrc::StrCrc32(*SourceObject->GetClass()->GetPathName()) : 0;
+	const uint32 StreamId = HashCombine(ClassHash, static_cast<uint32>(FallbackCriticalStreams.Num()));
+
+	FFallbackCriticalStream& Fallback = Found ? *Found : FallbackCriticalStreams.Add(SourceObject);
+	Fallback.Stream.Initialize(static_cast<int32>(HashCombine(static_cast<uint32>(RunSeed), StreamId)));
+	Fallback.RunSeed = RunSeed;
+	return Fallback.Stream;
+}
@@ -0,0 +1,125 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffectTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DamageBatchSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+class UGameplayEffect;
+
+/**
+ * 한 프레임 동안 들어온 데미지 스펙을 (대상, 공격자, GE, 공격력) 단위로 모아
+ * 프레임 끝에 대상별 GE 실행 한 번으로 처리.
+ * 히트 수는 Data.HitCount로 전달되고 크리티컬은 실행 안에서 히트마다 판정됨.
+ * 그룹의 첫 스펙 하나만 적용되므로 UDamageExecutionCalculation 실행만 가진 Instant GE만 합치고,
+ * 모디파이어/큐/지속시간이 있는 GE는 히트마다 그대로 적용.
+ * 피격 알림도 액터별로 모아 프레임당 한 번 OnDamageAggregated로 전달 (크리티컬 히트 몫은 따로 합산).
+ */
+UCLASS()
+class RUNNER_API UDamageBatchSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 데미지 스펙 예약 (프레임 끝에 합쳐서 적용)
+	void QueueDamage(UAbilitySystemComponent* TargetASC, const FGameplayEffectSpecHandle& SpecHandle);
+
+	// 예약된 데미지 즉시 적용
+	void FlushPendingDamage();
+
+	// 데미지 이벤트 예약 (프레임 끝에 액터당 한 번 OnDamageAggregated, CriticalDamage는 Damage 중 크리티컬 히트 몫)
+	void QueueDamageEvent(AActor* Target, float Damage, float CriticalDamage, int32 HitCount, int32 CriticalCount);
+
+	// 예약된 데미지 이벤트 즉시 전달
+	void DispatchDamageEvents();
+
+	// ICombatInterface 구현 여부 (클래스별 캐시)
+	bool ImplementsCombatInterface(const AActor* Actor);
+
+	// 히트를 합쳐 한 번 적용해도 결과가 같은 GE인지 (Instant + 데미지 실행만, GE별 캐시)
+	bool IsBatchableEffect(const UGameplayEffect* Def);
+
+	// 소스 AttributeSet이 없는 공격의 크리티컬 스트림 (소스 오브젝트별로 유지, 새 런이 시작되거나 런 시드가 바뀌면 재시드)
+	const FRandomStream& GetFallbackCriticalStream(const UObject* SourceObject, int32 RunSeed, int32 RunStartCount);
+
+private:
+	struct FBatchKey
+	{
+		const UAbilitySystemComponent* TargetASC = nullptr;
+		const UAbilitySystemComponent* SourceASC = nullptr;
+		const UGameplayEffect* Def = nullptr;
+		float AttackPower = 0.f;
+
+		bool operator==(const FBatchKey& Other) const
+		{
+			return TargetASC == Other.TargetASC && SourceASC == Other.SourceASC && Def == Other.Def && AttackPower == Other.AttackPower;
+		}
+
+		friend uint32 GetTypeHash(const FBatchKey& Key)
+		{
+			uint32 Hash = HashCombine(GetTypeHash(Key.TargetASC), GetTypeHash(Key.SourceASC));
+			Hash = HashCombine(Hash, GetTypeHash(Key.Def));
+			return HashCombine(Hash, GetTypeHash(Key.AttackPower));
+		}
+	};
+
+	struct FPendingDamage
+	{
+		TWeakObjectPtr<UAbilitySystemComponent> TargetASC;
+
+		// 그룹의 첫 스펙 (나머지 히트는 HitCount로만 반영)
+		FGameplayEffectSpecHandle SpecHandle;
+
+		int32 HitCount = 0;
+	};
+
+	TMap<FBatchKey, int32> PendingIndexByKey;
+
+	TArray<FPendingDamage> PendingDamages;
+
+	// 적용 중인 배치 (버퍼 재사용)
+	TArray<FPendingDamage> ApplyingDamages;
+
+	struct FDamageEvent
+	{
+		TWeakObjectPtr<AActor> Target;
+
+		float TotalDamage = 0.f;
+
+		float CriticalDamage = 0.f;
+
+		int32 HitCount = 0;
+
+		int32 CriticalCount = 0;
+	};
+
+	TMap<TWeakObjectPtr<AActor>, int32> EventIndexByActor;
+
+	TArray<FDamageEvent> PendingEvents;
+
+	// 전달 중인 이벤트 (버퍼 재사용)
+	TArray<FDamageEvent> DispatchingEvents;
+
+	TMap<TWeakObjectPtr<const UClass>, bool> CombatInterfaceByClass;
+
+	TMap<TWeakObjectPtr<const UGameplayEffect>, bool> BatchableByEffect;
+
+	struct FFallbackCriticalStream
+	{
+		FRandomStream Stream;
+
+		int32 RunSeed = 0;
+	};
+
+	TMap<TWeakObjectPtr<const UObject>, FFallbackCriticalStream> FallbackCriticalStreams;
+
+	// FallbackCriticalStreams를 만든 런 (바뀌면 순번부터 다시 매김)
+	int32 FallbackRunStartCount = 0;
+};
@@ -3,14 +3,20 @@
 
 #include "DamageExecutionCalculation.h"
 
+#include "DamageBatchSubsystem.h"
+#include "DamageMitigationProfile.h"
+#include "RogueliteSubsystem.h"
 #include "RunnerAttributeSet.h"
 #include "Runner/RunnerGameplayTags.h"
+#include "Runner/Interfaces/CombatInterface.h"
 
 struct FDamageStatics
 {
 	DECLARE_ATTRIBUTE_CAPTUREDEF(CriticalChance);
 	DECLARE_ATTRIBUTE_CAPTUREDEF(CriticalMultiplier);
 	DECLARE_ATTRIBUTE_CAPTUREDEF(IncomingDamage);
+	DECLARE_ATTRIBUTE_CAPTUREDEF(Armor);
+	DECLARE_ATTRIBUTE_CAPTUREDEF(FlatDamageReduction);
 
 	FDamageStatics()
 	{
@@ -20,6 +26,8 @@ struct FDamageStatics
 
 		// Target (피격자) 어트리뷰트
 		DEFINE_ATTRIBUTE_CAPTUREDEF(URunnerAttributeSet, IncomingDamage, Target, false);
+		DEFINE_ATTRIBUTE_CAPTUREDEF(URunnerAttributeSet, Armor, Target, false);
+		DEFINE_ATTRIBUTE_CAPTUREDEF(URunnerAttributeSet, FlatDamageReduction, Target, false);
 	}
 };
 
@@ -29,11 +37,54 @@ static const FDamageStatics& DamageStatics()
 	return Statics;
 }
 
+// 대상의 경감 수치 (실행당 한 번 수집)
+struct FDamageMitigation
+{
+	float Multiplier = 1.f;
+	float FlatReduction = 0.f;
+	float MinimumDamage = 0.f;
+
+	FDamageMitigation(const FGameplayEffectCustomExecutionParameters& ExecutionParams, const FAggregatorEvaluateParameters& EvalParams)
+	{
+		float Armor = 0.f;
+		ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().ArmorDef, EvalParams, Armor);
+		ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().FlatDamageReductionDef, EvalParams, FlatReduction);
+
+		UAbilitySystemComponent* TargetASC = ExecutionParams.GetTargetAbilitySystemComponent();
+		const ICombatInterface* TargetCombat = TargetASC ? Cast<ICombatInterface>(TargetASC->GetAvatarActor()) : nullptr;
+		const UDamageMitigationProfile* Profile = TargetCombat ? TargetCombat->GetDamageMitigationProfile() : nullptr;
+		if (!Profile)
+		{
+			// 프로필이 없어도 방어력은 기본 ArmorConstant로 적용 (저항/최소 데미지 없음)
+			Profile = GetDefault<UDamageMitigationProfile>();
+		}
+
+		FGameplayTagContainer AssetTags;
+		ExecutionParams.GetOwningSpec().GetAllAssetTags(AssetTags);
+		const FGameplayTagContainer DamageTypeTags = AssetTags.Filter(FGameplayTagContainer(TAG_Damage_Type));
+
+		Multiplier = Profile->GetArmorMultiplier(Armor) * Profile->GetResistanceMultiplier(DamageTypeTags);
+		MinimumDamage = Profile->MinimumDamage;
+	}
+
+	// 히트 하나에 적용 (배율 → 고정 경감 → 최소 데미지)
+	float Apply(float Damage) const
+	{
+		if (Damage <= 0.f)
+		{
+			return 0.f;
+		}
+		return FMath::Max(Damage * Multiplier - FlatReduction, MinimumDamage);
+	}
+};
+
 UDamageExecutionCalculation::UDamageExecutionCalculation(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	RelevantAttributesToCapture.Add(DamageStatics().CriticalChanceDef);
 	RelevantAttributesToCapture.Add(DamageStatics().CriticalMultiplierDef);
 	RelevantAttributesToCapture.Add(DamageStatics().IncomingDamageDef);
+	RelevantAttributesToCapture.Add(DamageStatics().ArmorDef);
+	RelevantAttributesToCapture.Add(DamageStatics().FlatDamageReductionDef);
 }
 
 void UDamageExecutionCalculation::Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams, FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const
@@ -55,6 +106,9 @@ void UDamageExecutionCalculation::Execute_Implementation(const FGameplayEffectCu
 	// Set by caller 값 가져오기
 	float AttackPower = Spec.GetSetByCallerMagnitude(TAG_Data_AttackPower, false, 0.f);
 
+	// 배치된 히트 수 (배치 없이 적용되면 1)
+	const int32 HitCount = FMath::Max(1, FMath::RoundToInt(Spec.GetSetByCallerMagnitude(TAG_Data_HitCount, false, 1.f)));
+
 	// 어트리뷰트 값 가져오기
 	float CritChance = 0.f;
 	float CritMultiplier = 1.2f;
@@ -67,17 +121,27 @@ void UDamageExecutionCalculation::Execute_Implementation(const FGameplayEffectCu
 
 	float BaseDamage = AttackPower;
 
-	// 크리티컬 판정
-	bool bIsCritical = FMath::FRand() < CritChance;
-	if (bIsCritical)
+	// 크리티컬 판정 (히트마다, 소스별 시드 스트림)
+	FRandomStream FallbackStream;
+	const FRandomStream& CriticalStream = GetCriticalStream(ExecutionParams, FallbackStream);
+
+	int32 CriticalCount = 0;
+	for (int32 HitIndex = 0; HitIndex < HitCount; ++HitIndex)
 	{
-		BaseDamage *= CritMultiplier;
+		if (CriticalStream.FRand() < CritChance)
+		{
+			++CriticalCount;
+		}
 	}
+	bool bIsCritical = CriticalCount > 0;
 
-	// TODO: 방어력 적용
-	float FinalDamage = BaseDamage;
+	// 방어력/저항/고정 경감 (실행당 한 번 계산 후 히트마다 적용)
+	const FDamageMitigation Mitigation(ExecutionParams, EvalParams);
+	const float HitDamage = Mitigation.Apply(BaseDamage);
+	const float CriticalHitDamage = Mitigation.Apply(BaseDamage * CritMultiplier);
+	float FinalDamage = HitDamage * (HitCount - CriticalCount) + CriticalHitDamage * CriticalCount;
 
-	// Spec에 정보 저장
+	// Spec에 정보 저장 (AttributeSet에서 데미지 이벤트로 전달)
 	FGameplayEffectSpec* MutableSpec = ExecutionParams.GetOwningSpecForPreExecuteMod();
 	if (MutableSpec)
 	{
@@ -85,6 +149,8 @@ void UDamageExecutionCalculation::Execute_Implementation(const FGameplayEffectCu
 		{
 			MutableSpec->AddDynamicAssetTag(TAG_Data_Critical);
 		}
+		MutableSpec->SetSetByCallerMagnitude(TAG_Data_CriticalCount, static_cast<float>(CriticalCount));
+		MutableSpec->SetSetByCallerMagnitude(TAG_Data_CriticalDamage, CriticalHitDamage * CriticalCount);
 	}
 
 	// 데미지 적용
@@ -97,3 +163,37 @@ void UDamageExecutionCalculation::Execute_Implementation(const FGameplayEffectCu
 				FinalDamage));
 	}
 }
+
+const FRandomStream& UDamageExecutionCalculation::GetCriticalStream(const FGameplayEffectCustomExecutionParameters& ExecutionParams, FRandomStream& OutFallback)
+{
+	UAbilitySystemComponent* SourceASC = ExecutionParams.GetSourceAbilitySystemComponent();
+
+	int32 RunSeed = 0;
+	int32 RunStartCount = 0;
+	if (URogueliteSubsystem* RogueliteSubsystem = URogueliteSubsystem::Get(SourceASC))
+	{
+		RunSeed = RogueliteSubsystem->GetRunSeed();
+		RunStartCount = RogueliteSubsystem->GetRunStartCount();
+	}
+
+	if (SourceASC)
+	{
+		if (const URunnerAttributeSet* SourceAttributeSet = SourceASC->GetSet<URunnerAttributeSet>())
+		{
+			return SourceAttributeSet->GetCriticalStream(RunSeed, RunStartCount);
+		}
+	}
+
+	// 소스 AttributeSet이 없으면 월드에 소스 오브젝트별로 유지되는 스트림 (실행마다 같은 수열로 다시 만들지 않음)
+	const UObject* SourceObject = ExecutionParams.GetOwningSpec().GetEffectContext().GetSourceObject();
+	const UWorld* World = SourceASC ? SourceASC->GetWorld() : (SourceObject ? SourceObject->GetWorld() : nullptr);
+	if (UDamageBatchSubsystem* DamageBatch = World ? World->GetSubsystem<UDamageBatchSubsystem>() : nullptr)
+	{
+		return DamageBatch->GetFallbackCriticalStream(SourceObject, RunSeed, RunStartCount);
+	}
+
+	// 월드가 없으면 이번 실행에만 쓰는 스트림
+	const uint32 SourceHash = SourceObject ? FCrc::StrCrc32(*SourceObject->GetClass()->GetPathName()) : 0;
+	OutFallback.Initialize(static_cast<int32>(HashCombine(static_cast<uint32>(RunSeed), SourceHash)));
+	return OutFallback;
+}
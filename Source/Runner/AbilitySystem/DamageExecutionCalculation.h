@@ -18,4 +18,7 @@ public:
 	UDamageExecutionCalculation(const FObjectInitializer& ObjectInitializer);
 	
 	virtual void Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams, FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const override;
+
+	// 크리티컬 판정 스트림 (소스 AttributeSet 소유, 없으면 UDamageBatchSubsystem의 소스별 스트림, 월드도 없으면 OutFallback)
+	static const FRandomStream& GetCriticalStream(const FGameplayEffectCustomExecutionParameters& ExecutionParams, FRandomStream& OutFallback);
 };
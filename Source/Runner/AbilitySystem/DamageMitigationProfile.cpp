@@ -0,0 +1,31 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "DamageMitigationProfile.h"
+
+float UDamageMitigationProfile::GetArmorMultiplier(float Armor) const
+{
+	if (Armor <= 0.f)
+	{
+		return 1.f;
+	}
+	return 1.f - Armor / (Armor + FMath::Max(ArmorConstant, 1.f));
+}
+
+float UDamageMitigationProfile::GetResistanceMultiplier(const FGameplayTagContainer& DamageTypeTags) const
+{
+	float Multiplier = 1.f;
+	if (DamageTypeTags.IsEmpty())
+	{
+		return Multiplier;
+	}
+
+	for (const TPair<FGameplayTag, float>& Resistance : Resistances)
+	{
+		if (DamageTypeTags.HasTag(Resistance.Key))
+		{
+			Multiplier *= 1.f - FMath::Clamp(Resistance.Value, 0.f, 1.f);
+		}
+	}
+	return Multiplier;
+}
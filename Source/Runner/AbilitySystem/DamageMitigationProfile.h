@@ -0,0 +1,39 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GameplayTagContainer.h"
+#include "DamageMitigationProfile.generated.h"
+
+/**
+ * 피격자의 데미지 경감 데이터.
+ * 방어력 → 데미지 타입 저항 → 고정 경감 순서로 히트마다 적용.
+ * 프로필이 없는 피격자는 이 클래스의 기본값(저항 없음)으로 방어력만 적용됨.
+ */
+UCLASS(BlueprintType)
+class RUNNER_API UDamageMitigationProfile : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// 방어력 경감률 = Armor / (Armor + ArmorConstant)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Armor", meta = (ClampMin = "1.0"))
+	float ArmorConstant = 100.f;
+
+	// 데미지 타입 태그별 저항 (0 ~ 1, 여러 개 일치하면 곱연산)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Resistance", meta = (Categories = "Damage.Type"))
+	TMap<FGameplayTag, float> Resistances;
+
+	// 경감 후 최소 데미지
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Resistance", meta = (ClampMin = "0.0"))
+	float MinimumDamage = 0.f;
+
+public:
+	// 방어력에 따른 데미지 배율
+	float GetArmorMultiplier(float Armor) const;
+
+	// 데미지 타입 태그에 따른 데미지 배율
+	float GetResistanceMultiplier(const FGameplayTagContainer& DamageTypeTags) const;
+};
@@ -3,10 +3,19 @@
 
 #include "RunnerAttributeSet.h"
 
+#include "DamageBatchSubsystem.h"
 #include "GameplayEffectExtension.h"
 #include "Runner/RunnerGameplayTags.h"
 #include "Runner/Interfaces/CombatInterface.h"
 
+URunnerAttributeSet::URunnerAttributeSet()
+{
+	// 이동 배율은 초기화 GE 없이도 기본값 그대로 동작하도록 1
+	InitMoveSpeedMultiplier(1.f);
+	InitJumpVelocityMultiplier(1.f);
+	InitAirControlMultiplier(1.f);
+}
+
 void URunnerAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
 {
 	Super::PreAttributeChange(Attribute, NewValue);
@@ -36,11 +45,28 @@ void URunnerAttributeSet::PostGameplayEffectExecute(const struct FGameplayEffect
 			const float NewHealth = GetHealth() - LocalDamage;
 			SetHealth(FMath::Clamp(NewHealth, 0.f, GetMaxHealth()));
 			
-			bool bIsCombatInterface = GetOwningActor()->Implements<UCombatInterface>();
+			UDamageBatchSubsystem* DamageBatch = GetWorld() ? GetWorld()->GetSubsystem<UDamageBatchSubsystem>() : nullptr;
+			
+			bool bIsCombatInterface = DamageBatch ? DamageBatch->ImplementsCombatInterface(GetOwningActor()) : GetOwningActor()->Implements<UCombatInterface>();
 			if (bIsCombatInterface)
 			{
-				bool bIsCriticalHit = Data.EffectSpec.GetDynamicAssetTags().HasTag(TAG_Data_Critical);
-				ICombatInterface::Execute_OnDamageApplied(GetOwningActor(),LocalDamage, bIsCriticalHit);
+				const FGameplayEffectSpec& Spec = Data.EffectSpec;
+				const int32 HitCount = FMath::Max(1, FMath::RoundToInt(Spec.GetSetByCallerMagnitude(TAG_Data_HitCount, false, 1.f)));
+				const bool bHasCriticalTag = Spec.GetDynamicAssetTags().HasTag(TAG_Data_Critical);
+				const int32 CriticalCount = FMath::RoundToInt(Spec.GetSetByCallerMagnitude(TAG_Data_CriticalCount, false, bHasCriticalTag ? 1.f : 0.f));
+				
+				// 크리티컬 히트 몫 (실행에서 기록, 없으면 크리티컬 여부에 따라 전부 또는 0)
+				const float CriticalDamage = FMath::Min(LocalDamage, Spec.GetSetByCallerMagnitude(TAG_Data_CriticalDamage, false, CriticalCount > 0 ? LocalDamage : 0.f));
+
+				// 프레임 끝에 액터당 한 번 합쳐서 알림
+				if (DamageBatch)
+				{
+					DamageBatch->QueueDamageEvent(GetOwningActor(), LocalDamage, CriticalDamage, HitCount, CriticalCount);
+				}
+				else
+				{
+					ICombatInterface::DispatchDamageAggregated(GetOwningActor(), LocalDamage, CriticalDamage, HitCount, CriticalCount);
+				}
 			}
 
 			// 사망 처리
@@ -60,3 +86,31 @@ void URunnerAttributeSet::PostGameplayEffectExecute(const struct FGameplayEffect
 		SetHealth(FMath::Clamp(GetHealth(), 0.f, GetMaxHealth()));
 	}
 }
+
+const FRandomStream& URunnerAttributeSet::GetCriticalStream(int32 RunSeed, int32 RunStartCount) const
+{
+	if (!CriticalStreamRunSeed.IsSet() || CriticalStreamRunSeed.GetValue() != RunSeed || CriticalStreamRunStartCount != RunStartCount)
+	{
+		// 액터 이름은 풀 재사용/스폰 이력에 따라 달라지므로 지정된 ID, 없으면 클래스 경로 사용
+		uint32 StreamId = 0;
+		if (CriticalStreamId.IsSet())
+		{
+			StreamId = CriticalStreamId.GetValue();
+		}
+		else if (const AActor* OwningActor = GetOwningActor())
+		{
+			StreamId = FCrc::StrCrc32(*OwningActor->GetClass()->GetPathName());
+		}
+
+		CriticalStream.Initialize(static_cast<int32>(HashCombine(static_cast<uint32>(RunSeed), StreamId)));
+		CriticalStreamRunSeed = RunSeed;
+		CriticalStreamRunStartCount = RunStartCount;
+	}
+	return CriticalStream;
+}
+
+void URunnerAttributeSet::SetCriticalStreamId(uint32 InStreamId)
+{
+	CriticalStreamId = InStreamId;
+	CriticalStreamRunSeed.Reset();
+}
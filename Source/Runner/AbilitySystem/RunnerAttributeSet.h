@@ -21,9 +21,17 @@ class RUNNER_API URunnerAttributeSet : public UAttributeSet
 	GENERATED_BODY()
 	
 public:
+	URunnerAttributeSet();
+
 	virtual void PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue) override;
 	virtual void PostGameplayEffectExecute(const struct FGameplayEffectModCallbackData& Data) override;
 
+	// 이 소스의 크리티컬 판정 스트림 (새 런이 시작되거나 스트림 ID가 바뀌면 런 시드 + 스트림 ID로 다시 시드)
+	const FRandomStream& GetCriticalStream(int32 RunSeed, int32 RunStartCount) const;
+
+	// 크리티컬 스트림 ID 지정 (다음 판정 때 처음부터 다시 시드, 지정하지 않으면 오너 클래스 경로 기준)
+	void SetCriticalStreamId(uint32 InStreamId);
+
 public:
 	UPROPERTY(BlueprintReadOnly)
 	FGameplayAttributeData Health;
@@ -41,6 +49,14 @@ public:
 	FGameplayAttributeData MoveSpeedMultiplier;
 	ATTRIBUTE_ACCESSORS(URunnerAttributeSet, MoveSpeedMultiplier)
 	
+	UPROPERTY(BlueprintReadOnly)
+	FGameplayAttributeData JumpVelocityMultiplier;
+	ATTRIBUTE_ACCESSORS(URunnerAttributeSet, JumpVelocityMultiplier)
+	
+	UPROPERTY(BlueprintReadOnly)
+	FGameplayAttributeData AirControlMultiplier;
+	ATTRIBUTE_ACCESSORS(URunnerAttributeSet, AirControlMultiplier)
+	
 	UPROPERTY(BlueprintReadOnly)
 	FGameplayAttributeData CriticalChance;
 	ATTRIBUTE_ACCESSORS(URunnerAttributeSet, CriticalChance)
@@ -49,7 +65,27 @@ public:
 	FGameplayAttributeData CriticalMultiplier;
 	ATTRIBUTE_ACCESSORS(URunnerAttributeSet, CriticalMultiplier)
 	
+	UPROPERTY(BlueprintReadOnly)
+	FGameplayAttributeData Armor;
+	ATTRIBUTE_ACCESSORS(URunnerAttributeSet, Armor)
+	
+	UPROPERTY(BlueprintReadOnly)
+	FGameplayAttributeData FlatDamageReduction;
+	ATTRIBUTE_ACCESSORS(URunnerAttributeSet, FlatDamageReduction)
+	
 	UPROPERTY(BlueprintReadOnly, Category = "Meta")
 	FGameplayAttributeData IncomingDamage;
 	ATTRIBUTE_ACCESSORS(URunnerAttributeSet, IncomingDamage)
+
+private:
+	// 소스별 크리티컬 스트림 (전역 RNG를 공유하지 않음)
+	mutable FRandomStream CriticalStream;
+	
+	mutable TOptional<int32> CriticalStreamRunSeed;
+
+	// 마지막으로 시드한 런 (같은 시드로 재시작해도 처음부터 다시 뽑도록)
+	mutable int32 CriticalStreamRunStartCount = 0;
+	
+	// 스폰 순번 등 이름과 무관하게 재현되는 식별자
+	TOptional<uint32> CriticalStreamId;
 };
\ No newline at end of file
@@ -4,24 +4,123 @@
 #include "EnemyBase.h"
 
 #include "AbilitySystemComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Runner/AbilitySystem/DamageBatchSubsystem.h"
 #include "Runner/AbilitySystem/RunnerAttributeSet.h"
+#include "Runner/Movement/AttributeMovementBindingComponent.h"
+#include "Runner/UI/DamageNumberSubsystem.h"
 
 
 AEnemyBase::AEnemyBase(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	AbilitySystemComponent =  CreateDefaultSubobject<UAbilitySystemComponent>(TEXT("AbilitySystemComponent"));
 	RunnerAttributeSet = CreateDefaultSubobject<URunnerAttributeSet>(TEXT("RunnerAttributeSet"));
+	MovementBinding = CreateDefaultSubobject<UAttributeMovementBindingComponent>(TEXT("MovementBinding"));
 }
 
 // Called when the game starts or when spawned
 void AEnemyBase::BeginPlay()
 {
+	// BP BeginPlay보다 먼저 기본 스탯 적용 (GE 없이 Base 값 직접 설정)
+	if (bInitializeFromArchetype)
+	{
+		if (UEnemyStatSubsystem* EnemyStats = GetWorld()->GetSubsystem<UEnemyStatSubsystem>())
+		{
+			ArchetypeIndex = EnemyStats->RegisterArchetype(GetClass(), ArchetypeStats);
+			EnemyStats->InitializeAttributes(AbilitySystemComponent, ArchetypeIndex);
+		}
+	}
+	
 	Super::BeginPlay();
 	
+	// BP 초기화 결과를 보관해 두고 풀에서 다시 꺼낼 때 복원 (죽은 체력을 이어받지 않도록)
+	if (ArchetypeIndex == INDEX_NONE)
+	{
+		InstanceBaseStats = UEnemyStatSubsystem::CaptureStats(AbilitySystemComponent);
+	}
+}
+
+void AEnemyBase::ActivateFromPool(const FTransform& SpawnTransform)
+{
+	bActiveInPool = true;
+	
+	SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+	
+	// 이전 생애의 효과/어빌리티 정리 후 초기값 복원
+	AbilitySystemComponent->RemoveActiveEffects(FGameplayEffectQuery());
+	AbilitySystemComponent->CancelAllAbilities();
+	if (ArchetypeIndex != INDEX_NONE)
+	{
+		if (UEnemyStatSubsystem* EnemyStats = GetWorld()->GetSubsystem<UEnemyStatSubsystem>())
+		{
+			EnemyStats->InitializeAttributes(AbilitySystemComponent, ArchetypeIndex);
+		}
+	}
+	else if (InstanceBaseStats.IsSet())
+	{
+		UEnemyStatSubsystem::ApplyStats(AbilitySystemComponent, InstanceBaseStats.GetValue());
+	}
+	
+	// 이전 생애의 크리티컬 스트림 위치를 이어받지 않도록 재시드
+	SetSpawnOrdinal(SpawnOrdinal);
+	
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(true);
+	SetMovementLOD(false);
+	GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+	
+	OnActivatedFromPool();
+}
+
+void AEnemyBase::SetSpawnOrdinal(int32 InSpawnOrdinal)
+{
+	SpawnOrdinal = InSpawnOrdinal;
+	RunnerAttributeSet->SetCriticalStreamId(HashCombine(FCrc::StrCrc32(*GetClass()->GetPathName()), static_cast<uint32>(SpawnOrdinal)));
+}
+
+void AEnemyBase::DeactivateToPool()
+{
+	bActiveInPool = false;
+	
+	GetCharacterMovement()->StopMovementImmediately();
+	GetCharacterMovement()->DisableMovement();
+	GetCharacterMovement()->SetComponentTickEnabled(false);
+	
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+	
+	OnDeactivatedToPool();
+}
+
+void AEnemyBase::SetMovementLOD(bool bLowDetail)
+{
+	bMovementLOD = bLowDetail;
+	
+	GetCharacterMovement()->SetComponentTickEnabled(bActiveInPool && !bLowDetail);
+	
+	// 원거리에서는 애니메이션도 보일 때만 갱신
+	GetMesh()->VisibilityBasedAnimTickOption = bLowDetail ? EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered : EVisibilityBasedAnimTickOption::AlwaysTickPose;
 }
 
 void AEnemyBase::ApplyDamageEffect_Implementation(const FGameplayEffectSpecHandle& InEffectHandle)
 {
-	UE_LOG(LogTemp,Warning,TEXT("Damage Applied"))
+	// 같은 프레임의 히트는 모아서 한 번에 실행
+	if (UDamageBatchSubsystem* DamageBatch = GetWorld()->GetSubsystem<UDamageBatchSubsystem>())
+	{
+		DamageBatch->QueueDamage(AbilitySystemComponent, InEffectHandle);
+		return;
+	}
 	AbilitySystemComponent->BP_ApplyGameplayEffectSpecToSelf(InEffectHandle);
 }
+
+void AEnemyBase::OnDamageApplied_Implementation(float DamageAmount, bool bIsCriticalHit)
+{
+	// 풀링된 데미지 숫자로 표시 (히트마다 위젯 액터를 스폰하지 않음)
+	if (UDamageNumberSubsystem* DamageNumbers = GetWorld()->GetSubsystem<UDamageNumberSubsystem>())
+	{
+		DamageNumbers->ShowDamageNumber(this, DamageAmount, bIsCriticalHit);
+	}
+}
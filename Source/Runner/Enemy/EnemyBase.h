@@ -5,10 +5,13 @@
 #include "CoreMinimal.h"
 #include "AbilitySystemInterface.h"
 #include "GameFramework/Character.h"
+#include "Runner/Enemy/EnemyStatSubsystem.h"
 #include "Runner/Interfaces/CombatInterface.h"
 #include "EnemyBase.generated.h"
 
 class URunnerAttributeSet;
+class UDamageMitigationProfile;
+class UAttributeMovementBindingComponent;
 
 UCLASS()
 class RUNNER_API AEnemyBase : public ACharacter, public IAbilitySystemInterface, public ICombatInterface
@@ -20,14 +23,39 @@ public:
 	AEnemyBase(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override { return AbilitySystemComponent; }
+	
+	// 풀에서 꺼낼 때 호출 (ASC는 유지하고 효과/어트리뷰트만 아키타입 기본값, BP 초기화면 첫 BeginPlay 직후 값으로 복원)
+	virtual void ActivateFromPool(const FTransform& SpawnTransform);
+	
+	// 풀로 돌려보낼 때 호출 (숨김, 충돌/틱 비활성화)
+	virtual void DeactivateToPool();
+	
+	// 런 안에서의 스폰 순번 지정 (클래스 경로와 함께 크리티컬 스트림 시드로 사용)
+	void SetSpawnOrdinal(int32 InSpawnOrdinal);
+	
+	// 원거리 LOD (CharacterMovement 틱 생략)
+	void SetMovementLOD(bool bLowDetail);
+	
+	bool IsMovementLOD() const { return bMovementLOD; }
+	
+	bool IsActiveInPool() const { return bActiveInPool; }
+	
+protected:
+	UFUNCTION(BlueprintImplementableEvent)
+	void OnActivatedFromPool();
+	
+	UFUNCTION(BlueprintImplementableEvent)
+	void OnDeactivatedToPool();
+	
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 	
 	virtual void ApplyDamageEffect_Implementation(const FGameplayEffectSpecHandle& InEffectHandle) override;
-	virtual void OnDamageApplied_Implementation(float DamageAmount, bool bIsCriticalHit) override {}
+	virtual void OnDamageApplied_Implementation(float DamageAmount, bool bIsCriticalHit) override;
 	virtual void Die_Implementation() override {}
 	virtual bool IsDead_Implementation() override {return false;}
+	virtual const UDamageMitigationProfile* GetDamageMitigationProfile() const override { return MitigationProfile; }
 	
 protected:
 	UPROPERTY(BlueprintReadOnly)
@@ -35,4 +63,33 @@ protected:
 	
 	UPROPERTY(BlueprintReadOnly)
 	URunnerAttributeSet* RunnerAttributeSet;
+	
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Combat")
+	UDamageMitigationProfile* MitigationProfile;
+	
+	// 이동 배율 어트리뷰트 -> CharacterMovement (프레임당 1회 적용)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	UAttributeMovementBindingComponent* MovementBinding;
+	
+	// 클래스 공유 기본 스탯 (bInitializeFromArchetype일 때 UEnemyStatSubsystem 테이블에 한 번만 등록)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Stats", meta = (EditCondition = "bInitializeFromArchetype"))
+	FEnemyArchetypeStats ArchetypeStats;
+	
+	// 켜면 ArchetypeStats로 초기화 (초기화 GE를 쓰지 않는 클래스만 켤 것, 끄면 BP 초기화 결과를 재사용 시 복원)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Stats")
+	bool bInitializeFromArchetype = false;
+	
+private:
+	// 스탯 테이블 인덱스
+	int32 ArchetypeIndex = INDEX_NONE;
+	
+	// BP에서 직접 초기화한 경우 BeginPlay 직후의 기본 스탯 (재사용 시 복원)
+	TOptional<FEnemyArchetypeStats> InstanceBaseStats;
+	
+	// 런 안에서의 스폰 순번
+	int32 SpawnOrdinal = 0;
+	
+	bool bActiveInPool = true;
+	
+	bool bMovementLOD = false;
 };
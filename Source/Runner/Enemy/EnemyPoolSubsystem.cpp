@@ -0,0 +1,191 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EnemyPoolSubsystem.h"
+
+#include "EnemyBase.h"
+#include "Kismet/GameplayStatics.h"
+#include "Runner/RunnerSettings.h"
+#include "RogueliteSubsystem.h"
+
+void UEnemyPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (URogueliteSubsystem* RogueliteSubsystem = URogueliteSubsystem::Get(this))
+	{
+		RogueliteSubsystem->OnRunStarted.AddDynamic(this, &UEnemyPoolSubsystem::HandleRunStarted);
+	}
+}
+
+void UEnemyPoolSubsystem::Deinitialize()
+{
+	if (URogueliteSubsystem* RogueliteSubsystem = URogueliteSubsystem::Get(this))
+	{
+		RogueliteSubsystem->OnRunStarted.RemoveDynamic(this, &UEnemyPoolSubsystem::HandleRunStarted);
+	}
+
+	Pools.Reset();
+	ActiveEnemies.Reset();
+
+	Super::Deinitialize();
+}
+
+void UEnemyPoolSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UpdateMovementLOD();
+}
+
+TStatId UEnemyPoolSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyPoolSubsystem, STATGROUP_Tickables);
+}
+
+AEnemyBase* UEnemyPoolSubsystem::SpawnEnemy(TSubclassOf<AEnemyBase> EnemyClass, const FTransform& SpawnTransform)
+{
+	if (!EnemyClass)
+	{
+		return nullptr;
+	}
+
+	FEnemyPool& Pool = Pools.FindOrAdd(EnemyClass);
+	while (Pool.FreeEnemies.Num() > 0)
+	{
+		AEnemyBase* Enemy = Pool.FreeEnemies.Pop(EAllowShrinking::No);
+		if (IsValid(Enemy))
+		{
+			Enemy->SetSpawnOrdinal(AllocateSpawnOrdinal());
+			Enemy->ActivateFromPool(SpawnTransform);
+			ActiveEnemies.Add(Enemy);
+			return Enemy;
+		}
+	}
+
+	AEnemyBase* Enemy = SpawnNewEnemy(EnemyClass, SpawnTransform);
+	if (Enemy)
+	{
+		Enemy->SetSpawnOrdinal(AllocateSpawnOrdinal());
+		ActiveEnemies.Add(Enemy);
+	}
+	return Enemy;
+}
+
+TArray<AEnemyBase*> UEnemyPoolSubsystem::SpawnWave(const TArray<TSubclassOf<AEnemyBase>>& EnemyClasses, const FRogueliteWeightedPool& Pool, FGameplayTag StreamKey, const TArray<FTransform>& SpawnTransforms)
+{
+	TArray<AEnemyBase*> Spawned;
+
+	URogueliteSubsystem* RogueliteSubsystem = URogueliteSubsystem::Get(this);
+	if (!RogueliteSubsystem || SpawnTransforms.Num() == 0)
+	{
+		return Spawned;
+	}
+
+	// 런 스트림에서 웨이브 전체를 한 번에 추첨
+	const TArray<int32> Picked = RogueliteSubsystem->DrawFromWeightedPool(Pool, StreamKey, SpawnTransforms.Num(), false);
+
+	Spawned.Reserve(Picked.Num());
+	for (int32 i = 0; i < Picked.Num(); ++i)
+	{
+		if (!EnemyClasses.IsValidIndex(Picked[i]))
+		{
+			continue;
+		}
+
+		if (AEnemyBase* Enemy = SpawnEnemy(EnemyClasses[Picked[i]], SpawnTransforms[i]))
+		{
+			Spawned.Add(Enemy);
+		}
+	}
+	return Spawned;
+}
+
+void UEnemyPoolSubsystem::ReleaseEnemy(AEnemyBase* Enemy)
+{
+	if (!IsValid(Enemy) || !Enemy->IsActiveInPool())
+	{
+		return;
+	}
+
+	Enemy->DeactivateToPool();
+	ActiveEnemies.RemoveSingleSwap(Enemy, EAllowShrinking::No);
+	Pools.FindOrAdd(Enemy->GetClass()).FreeEnemies.Add(Enemy);
+}
+
+void UEnemyPoolSubsystem::PrewarmPool(TSubclassOf<AEnemyBase> EnemyClass, int32 Count)
+{
+	if (!EnemyClass)
+	{
+		return;
+	}
+
+	const int32 NumToSpawn = Count - Pools.FindOrAdd(EnemyClass).FreeEnemies.Num();
+	for (int32 i = 0; i < NumToSpawn; ++i)
+	{
+		if (AEnemyBase* Enemy = SpawnNewEnemy(EnemyClass, FTransform::Identity))
+		{
+			Enemy->DeactivateToPool();
+			Pools.FindOrAdd(EnemyClass).FreeEnemies.Add(Enemy);
+		}
+	}
+}
+
+AEnemyBase* UEnemyPoolSubsystem::SpawnNewEnemy(TSubclassOf<AEnemyBase> EnemyClass, const FTransform& SpawnTransform)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	return GetWorld()->SpawnActor<AEnemyBase>(EnemyClass, SpawnTransform, SpawnParams);
+}
+
+void UEnemyPoolSubsystem::HandleRunStarted()
+{
+	NextSpawnOrdinal = 0;
+}
+
+void UEnemyPoolSubsystem::UpdateMovementLOD()
+{
+	const int32 NumEnemies = ActiveEnemies.Num();
+	if (NumEnemies == 0)
+	{
+		return;
+	}
+
+	const APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	if (!PlayerPawn)
+	{
+		return;
+	}
+
+	const URunnerSettings* Settings = URunnerSettings::Get();
+	const FVector PlayerLocation = PlayerPawn->GetActorLocation();
+
+	// 경계에서 깜빡이지 않도록 들어올 때와 나갈 때 거리를 다르게
+	const float LODDistanceSq = FMath::Square(Settings->EnemyMovementLODDistance);
+	const float RestoreDistanceSq = FMath::Square(Settings->EnemyMovementLODDistance * 0.9f);
+
+	const int32 NumToUpdate = FMath::Min(NumEnemies, FMath::Max(1, Settings->EnemyMovementLODUpdatesPerTick));
+	for (int32 i = 0; i < NumToUpdate && ActiveEnemies.Num() > 0; ++i)
+	{
+		LODCursor = (LODCursor + 1) % ActiveEnemies.Num();
+
+		// 풀을 거치지 않고 파괴된 적 정리
+		AEnemyBase* Enemy = ActiveEnemies[LODCursor];
+		if (!IsValid(Enemy))
+		{
+			ActiveEnemies.RemoveAtSwap(LODCursor, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		const float DistanceSq = FVector::DistSquared(Enemy->GetActorLocation(), PlayerLocation);
+		if (!Enemy->IsMovementLOD() && DistanceSq > LODDistanceSq)
+		{
+			Enemy->SetMovementLOD(true);
+		}
+		else if (Enemy->IsMovementLOD() && DistanceSq < RestoreDistanceSq)
+		{
+			Enemy->SetMovementLOD(false);
+		}
+	}
+}
@@ -0,0 +1,83 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RogueliteWeightedPool.h"
+#include "EnemyPoolSubsystem.generated.h"
+
+class AEnemyBase;
+
+USTRUCT()
+struct FEnemyPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AEnemyBase>> FreeEnemies;
+};
+
+/**
+ * AEnemyBase 스폰/회수 풀과 거리 기반 이동 LOD 관리.
+ * 회수된 적은 ASC를 다시 만들지 않고 어트리뷰트만 초기값으로 복원해 재사용.
+ */
+UCLASS()
+class RUNNER_API UEnemyPoolSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 풀에서 꺼내거나 새로 스폰
+	UFUNCTION(BlueprintCallable, Category = "Enemy")
+	AEnemyBase* SpawnEnemy(TSubclassOf<AEnemyBase> EnemyClass, const FTransform& SpawnTransform);
+
+	// 웨이브 한 번에 스폰 (SpawnTransforms 수만큼 가중치 풀에서 추첨, Pool 항목 i = EnemyClasses[i])
+	UFUNCTION(BlueprintCallable, Category = "Enemy")
+	TArray<AEnemyBase*> SpawnWave(const TArray<TSubclassOf<AEnemyBase>>& EnemyClasses, const FRogueliteWeightedPool& Pool, FGameplayTag StreamKey, const TArray<FTransform>& SpawnTransforms);
+
+	// 풀로 회수 (Destroy 대신 호출)
+	UFUNCTION(BlueprintCallable, Category = "Enemy")
+	void ReleaseEnemy(AEnemyBase* Enemy);
+
+	// 미리 생성해 풀에 넣어 둠
+	UFUNCTION(BlueprintCallable, Category = "Enemy")
+	void PrewarmPool(TSubclassOf<AEnemyBase> EnemyClass, int32 Count);
+
+	UFUNCTION(BlueprintCallable, Category = "Enemy")
+	int32 GetActiveEnemyCount() const { return ActiveEnemies.Num(); }
+
+	UFUNCTION(BlueprintCallable, Category = "Enemy")
+	const TArray<AEnemyBase*>& GetActiveEnemies() const { return ActiveEnemies; }
+
+private:
+	AEnemyBase* SpawnNewEnemy(TSubclassOf<AEnemyBase> EnemyClass, const FTransform& SpawnTransform);
+
+	// 거리 LOD 갱신 (틱당 일부만)
+	void UpdateMovementLOD();
+
+	// 현재 런의 다음 스폰 순번
+	int32 AllocateSpawnOrdinal() { return NextSpawnOrdinal++; }
+
+	// 런이 시작되면 스폰 순번을 0부터 다시 셈
+	UFUNCTION()
+	void HandleRunStarted();
+
+private:
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, FEnemyPool> Pools;
+
+	UPROPERTY(Transient)
+	TArray<AEnemyBase*> ActiveEnemies;
+
+	// 다음 LOD 갱신 시작 인덱스
+	int32 LODCursor = 0;
+
+	// 다음 스폰 순번 (같은 시드로 같은 순서로 스폰하면 같은 순번)
+	int32 NextSpawnOrdinal = 0;
+};
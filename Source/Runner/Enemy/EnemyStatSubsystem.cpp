@@ -0,0 +1,76 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EnemyStatSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "Runner/AbilitySystem/RunnerAttributeSet.h"
+
+void UEnemyStatSubsystem::Deinitialize()
+{
+	ArchetypeStats.Reset();
+	ArchetypeIndexByClass.Reset();
+
+	Super::Deinitialize();
+}
+
+int32 UEnemyStatSubsystem::RegisterArchetype(const UClass* ArchetypeClass, const FEnemyArchetypeStats& Stats)
+{
+	if (const int32* Index = ArchetypeIndexByClass.Find(ArchetypeClass))
+	{
+		return *Index;
+	}
+
+	const int32 Index = ArchetypeStats.Add(Stats);
+	ArchetypeIndexByClass.Add(ArchetypeClass, Index);
+	return Index;
+}
+
+const FEnemyArchetypeStats* UEnemyStatSubsystem::GetArchetypeStats(int32 ArchetypeIndex) const
+{
+	return ArchetypeStats.IsValidIndex(ArchetypeIndex) ? &ArchetypeStats[ArchetypeIndex] : nullptr;
+}
+
+void UEnemyStatSubsystem::InitializeAttributes(UAbilitySystemComponent* AbilitySystemComponent, int32 ArchetypeIndex) const
+{
+	if (const FEnemyArchetypeStats* Stats = GetArchetypeStats(ArchetypeIndex))
+	{
+		ApplyStats(AbilitySystemComponent, *Stats);
+	}
+}
+
+void UEnemyStatSubsystem::ApplyStats(UAbilitySystemComponent* AbilitySystemComponent, const FEnemyArchetypeStats& Stats)
+{
+	if (!IsValid(AbilitySystemComponent))
+	{
+		return;
+	}
+
+	AbilitySystemComponent->SetNumericAttributeBase(URunnerAttributeSet::GetMaxHealthAttribute(), Stats.MaxHealth);
+	AbilitySystemComponent->SetNumericAttributeBase(URunnerAttributeSet::GetHealthAttribute(), Stats.MaxHealth);
+	AbilitySystemComponent->SetNumericAttributeBase(URunnerAttributeSet::GetAttackSpeedAttribute(), Stats.AttackSpeed);
+	AbilitySystemComponent->SetNumericAttributeBase(URunnerAttributeSet::GetMoveSpeedMultiplierAttribute(), Stats.MoveSpeedMultiplier);
+	AbilitySystemComponent->SetNumericAttributeBase(URunnerAttributeSet::GetCriticalChanceAttribute(), Stats.CriticalChance);
+	AbilitySystemComponent->SetNumericAttributeBase(URunnerAttributeSet::GetCriticalMultiplierAttribute(), Stats.CriticalMultiplier);
+	AbilitySystemComponent->SetNumericAttributeBase(URunnerAttributeSet::GetArmorAttribute(), Stats.Armor);
+	AbilitySystemComponent->SetNumericAttributeBase(URunnerAttributeSet::GetFlatDamageReductionAttribute(), Stats.FlatDamageReduction);
+	AbilitySystemComponent->SetNumericAttributeBase(URunnerAttributeSet::GetIncomingDamageAttribute(), 0.f);
+}
+
+FEnemyArchetypeStats UEnemyStatSubsystem::CaptureStats(const UAbilitySystemComponent* AbilitySystemComponent)
+{
+	FEnemyArchetypeStats Stats;
+	if (!IsValid(AbilitySystemComponent))
+	{
+		return Stats;
+	}
+
+	Stats.MaxHealth = AbilitySystemComponent->GetNumericAttributeBase(URunnerAttributeSet::GetMaxHealthAttribute());
+	Stats.AttackSpeed = AbilitySystemComponent->GetNumericAttributeBase(URunnerAttributeSet::GetAttackSpeedAttribute());
+	Stats.MoveSpeedMultiplier = AbilitySystemComponent->GetNumericAttributeBase(URunnerAttributeSet::GetMoveSpeedMultiplierAttribute());
+	Stats.CriticalChance = AbilitySystemComponent->GetNumericAttributeBase(URunnerAttributeSet::GetCriticalChanceAttribute());
+	Stats.CriticalMultiplier = AbilitySystemComponent->GetNumericAttributeBase(URunnerAttributeSet::GetCriticalMultiplierAttribute());
+	Stats.Armor = AbilitySystemComponent->GetNumericAttributeBase(URunnerAttributeSet::GetArmorAttribute());
+	Stats.FlatDamageReduction = AbilitySystemComponent->GetNumericAttributeBase(URunnerAttributeSet::GetFlatDamageReductionAttribute());
+	return Stats;
+}
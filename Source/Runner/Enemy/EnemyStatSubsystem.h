@@ -0,0 +1,75 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyStatSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+
+/**
+ * 적 아키타입의 기본 스탯.
+ * 같은 클래스의 적은 이 값을 초기값으로 공유함. 어트리뷰트는 여전히 인스턴스마다 AttributeSet에 있으므로 메모리 절감이 아니라 초기화 비용(GE 적용) 절감용.
+ */
+USTRUCT(BlueprintType)
+struct RUNNER_API FEnemyArchetypeStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = "1.0"))
+	float MaxHealth = 100.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	float AttackSpeed = 1.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	float MoveSpeedMultiplier = 1.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	float CriticalChance = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	float CriticalMultiplier = 1.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	float Armor = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	float FlatDamageReduction = 0.f;
+};
+
+/**
+ * 적 아키타입 스탯 테이블.
+ * 클래스별 기본 스탯을 연속 배열에 한 번만 저장하고, 스폰/재사용 시 GE 없이 어트리뷰트 Base 값을 바로 채움.
+ * bInitializeFromArchetype을 켠 적 클래스만 사용.
+ */
+UCLASS()
+class RUNNER_API UEnemyStatSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// 아키타입 등록 (이미 있으면 기존 인덱스)
+	int32 RegisterArchetype(const UClass* ArchetypeClass, const FEnemyArchetypeStats& Stats);
+
+	const FEnemyArchetypeStats* GetArchetypeStats(int32 ArchetypeIndex) const;
+
+	int32 GetArchetypeCount() const { return ArchetypeStats.Num(); }
+
+	// 아키타입 기본값으로 어트리뷰트 초기화 (Health = MaxHealth)
+	void InitializeAttributes(UAbilitySystemComponent* AbilitySystemComponent, int32 ArchetypeIndex) const;
+
+	// 스탯 값으로 어트리뷰트 Base 값 설정 (Health = MaxHealth)
+	static void ApplyStats(UAbilitySystemComponent* AbilitySystemComponent, const FEnemyArchetypeStats& Stats);
+
+	// 현재 어트리뷰트 Base 값을 스탯으로 읽기 (BP에서 직접 초기화한 적의 재사용용)
+	static FEnemyArchetypeStats CaptureStats(const UAbilitySystemComponent* AbilitySystemComponent);
+
+private:
+	TArray<FEnemyArchetypeStats> ArchetypeStats;
+
+	TMap<const UClass*, int32> ArchetypeIndexByClass;
+};
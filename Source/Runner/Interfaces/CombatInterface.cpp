@@ -5,3 +5,34 @@
 
 
 // Add default functionality here for any ICombatInterface functions that are not pure virtual.
+
+// 크리티컬 몫은 따로 알려서 데미지 숫자가 크리티컬 표시를 잃지 않게 함
+static void NotifySplitDamage(UObject* Target, float TotalDamage, float CriticalDamage, int32 CriticalCount)
+{
+	const float NormalDamage = TotalDamage - CriticalDamage;
+	if (NormalDamage > 0.f || CriticalCount == 0)
+	{
+		ICombatInterface::Execute_OnDamageApplied(Target, NormalDamage, false);
+	}
+	if (CriticalCount > 0)
+	{
+		ICombatInterface::Execute_OnDamageApplied(Target, CriticalDamage, true);
+	}
+}
+
+void ICombatInterface::OnDamageAggregated(float TotalDamage, float CriticalDamage, int32 HitCount, int32 CriticalCount)
+{
+	NotifySplitDamage(_getUObject(), TotalDamage, CriticalDamage, CriticalCount);
+}
+
+void ICombatInterface::DispatchDamageAggregated(UObject* Target, float TotalDamage, float CriticalDamage, int32 HitCount, int32 CriticalCount)
+{
+	// 네이티브 구현체는 VM을 거치지 않고 호출
+	if (ICombatInterface* CombatInterface = Cast<ICombatInterface>(Target))
+	{
+		CombatInterface->OnDamageAggregated(TotalDamage, CriticalDamage, HitCount, CriticalCount);
+		return;
+	}
+
+	NotifySplitDamage(Target, TotalDamage, CriticalDamage, CriticalCount);
+}
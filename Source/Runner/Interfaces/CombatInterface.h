@@ -7,6 +7,7 @@
 #include "CombatInterface.generated.h"
 
 struct FGameplayEffectSpecHandle;
+class UDamageMitigationProfile;
 // This class does not need to be modified.
 UINTERFACE(BlueprintType)
 class UCombatInterface : public UInterface
@@ -33,4 +34,13 @@ public:
 	
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable)
 	bool IsDead();
+	
+	// 데미지 실행에서 히트마다 호출되므로 BlueprintNativeEvent가 아닌 네이티브 가상 함수
+	virtual const UDamageMitigationProfile* GetDamageMitigationProfile() const { return nullptr; }
+	
+	// 한 프레임 동안 받은 데미지 합계 (기본: 일반 몫과 크리티컬 몫을 나눠 OnDamageApplied 호출)
+	virtual void OnDamageAggregated(float TotalDamage, float CriticalDamage, int32 HitCount, int32 CriticalCount);
+	
+	// 네이티브 구현체는 OnDamageAggregated, 블루프린트 구현체는 같은 방식으로 나눈 OnDamageApplied 호출
+	static void DispatchDamageAggregated(UObject* Target, float TotalDamage, float CriticalDamage, int32 HitCount, int32 CriticalCount);
 };
\ No newline at end of file
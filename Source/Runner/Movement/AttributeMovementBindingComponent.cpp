@@ -0,0 +1,190 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AttributeMovementBindingComponent.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Runner/AbilitySystem/RunnerAttributeSet.h"
+
+UAttributeMovementBindingComponent::UAttributeMovementBindingComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PrePhysics;
+	bWantsInitializeComponent = true;
+
+	Bindings.Add({ URunnerAttributeSet::GetMoveSpeedMultiplierAttribute(), EMovementBindingTarget::MaxWalkSpeed });
+	Bindings.Add({ URunnerAttributeSet::GetJumpVelocityMultiplierAttribute(), EMovementBindingTarget::JumpZVelocity });
+	Bindings.Add({ URunnerAttributeSet::GetAirControlMultiplierAttribute(), EMovementBindingTarget::AirControl });
+}
+
+void UAttributeMovementBindingComponent::InitializeComponent()
+{
+	Super::InitializeComponent();
+
+	// BeginPlay 전에 바인딩해야 BeginPlay의 초기 스탯 적용도 받음
+	const ACharacter* Character = Cast<ACharacter>(GetOwner());
+	MovementComponent = Character ? Character->GetCharacterMovement() : nullptr;
+	AbilitySystemComponent = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetOwner());
+	if (!MovementComponent || !AbilitySystemComponent)
+	{
+		return;
+	}
+
+	check(Bindings.Num() <= 32);
+
+	BaseValues.SetNum(Bindings.Num());
+	for (int32 i = 0; i < Bindings.Num(); ++i)
+	{
+		BaseValues[i] = ReadMovementValue(MovementComponent, Bindings[i].Target);
+
+		const FGameplayAttribute& Attribute = Bindings[i].Attribute;
+		if (Attribute.IsValid() && !ChangeHandles.Contains(Attribute))
+		{
+			ChangeHandles.Add(Attribute, AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UAttributeMovementBindingComponent::OnAttributeChanged));
+		}
+	}
+}
+
+void UAttributeMovementBindingComponent::UninitializeComponent()
+{
+	if (AbilitySystemComponent)
+	{
+		for (const TPair<FGameplayAttribute, FDelegateHandle>& Pair : ChangeHandles)
+		{
+			AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(Pair.Key).Remove(Pair.Value);
+		}
+	}
+	ChangeHandles.Reset();
+
+	Super::UninitializeComponent();
+}
+
+void UAttributeMovementBindingComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	FlushPendingBindings();
+}
+
+void UAttributeMovementBindingComponent::SetBaseValue(EMovementBindingTarget Target, float Value)
+{
+	uint32 Mask = 0;
+	for (int32 i = 0; i < BaseValues.Num(); ++i)
+	{
+		if (Bindings[i].Target == Target)
+		{
+			BaseValues[i] = Value;
+			Mask |= 1u << i;
+		}
+	}
+	MarkDirty(Mask);
+}
+
+float UAttributeMovementBindingComponent::GetBaseValue(EMovementBindingTarget Target) const
+{
+	for (int32 i = 0; i < BaseValues.Num(); ++i)
+	{
+		if (Bindings[i].Target == Target)
+		{
+			return BaseValues[i];
+		}
+	}
+	return ReadMovementValue(MovementComponent, Target);
+}
+
+void UAttributeMovementBindingComponent::FlushPendingBindings()
+{
+	if (DirtyMask != 0 && MovementComponent && AbilitySystemComponent)
+	{
+		for (int32 i = 0; i < BaseValues.Num(); ++i)
+		{
+			const uint32 Bit = 1u << i;
+			const FGameplayAttribute& Attribute = Bindings[i].Attribute;
+			if (!(DirtyMask & Bit) || !AbilitySystemComponent->HasAttributeSetForAttribute(Attribute))
+			{
+				continue;
+			}
+
+			// 초기화되지 않은 어트리뷰트(0)가 기준값을 지워 멈춰 서지 않도록, 값을 받기 전에는 이동 값을 그대로 둠
+			const float Multiplier = AbilitySystemComponent->GetNumericAttribute(Attribute);
+			if (Multiplier == 0.f && !(InitializedMask & Bit))
+			{
+				continue;
+			}
+
+			InitializedMask |= Bit;
+			WriteMovementValue(MovementComponent, Bindings[i].Target, BaseValues[i] * Multiplier);
+		}
+	}
+
+	DirtyMask = 0;
+	SetComponentTickEnabled(false);
+}
+
+void UAttributeMovementBindingComponent::OnAttributeChanged(const FOnAttributeChangeData& Data)
+{
+	uint32 Mask = 0;
+	for (int32 i = 0; i < BaseValues.Num(); ++i)
+	{
+		if (Bindings[i].Attribute == Data.Attribute)
+		{
+			Mask |= 1u << i;
+		}
+	}
+	InitializedMask |= Mask;
+	MarkDirty(Mask);
+}
+
+void UAttributeMovementBindingComponent::MarkDirty(uint32 Mask)
+{
+	if (Mask == 0)
+	{
+		return;
+	}
+
+	// 첫 변경에서만 틱 활성화
+	if (DirtyMask == 0)
+	{
+		SetComponentTickEnabled(true);
+	}
+	DirtyMask |= Mask;
+}
+
+float UAttributeMovementBindingComponent::ReadMovementValue(const UCharacterMovementComponent* Movement, EMovementBindingTarget Target)
+{
+	if (!Movement)
+	{
+		return 0.f;
+	}
+
+	switch (Target)
+	{
+	case EMovementBindingTarget::MaxWalkSpeed:
+		return Movement->MaxWalkSpeed;
+	case EMovementBindingTarget::JumpZVelocity:
+		return Movement->JumpZVelocity;
+	case EMovementBindingTarget::AirControl:
+		return Movement->AirControl;
+	}
+	return 0.f;
+}
+
+void UAttributeMovementBindingComponent::WriteMovementValue(UCharacterMovementComponent* Movement, EMovementBindingTarget Target, float Value)
+{
+	switch (Target)
+	{
+	case EMovementBindingTarget::MaxWalkSpeed:
+		Movement->MaxWalkSpeed = Value;
+		break;
+	case EMovementBindingTarget::JumpZVelocity:
+		Movement->JumpZVelocity = Value;
+		break;
+	case EMovementBindingTarget::AirControl:
+		Movement->AirControl = Value;
+		break;
+	}
+}
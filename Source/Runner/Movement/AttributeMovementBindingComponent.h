@@ -0,0 +1,94 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "Components/ActorComponent.h"
+#include "AttributeMovementBindingComponent.generated.h"
+
+class UAbilitySystemComponent;
+class UCharacterMovementComponent;
+struct FOnAttributeChangeData;
+
+UENUM(BlueprintType)
+enum class EMovementBindingTarget : uint8
+{
+	MaxWalkSpeed,
+	JumpZVelocity,
+	AirControl
+};
+
+USTRUCT(BlueprintType)
+struct FAttributeMovementBinding
+{
+	GENERATED_BODY()
+
+	// 배율 어트리뷰트 (적용값 = 기준값 * 어트리뷰트)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement")
+	FGameplayAttribute Attribute;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement")
+	EMovementBindingTarget Target = EMovementBindingTarget::MaxWalkSpeed;
+};
+
+/**
+ * 배율 어트리뷰트를 CharacterMovement 값에 연결.
+ * 변경은 표시만 해두고 다음 틱(PrePhysics)에 한 번만 적용하므로 한 프레임에 여러 번 바뀌어도 비용은 1회.
+ */
+UCLASS(ClassGroup = (Runner), meta = (BlueprintSpawnableComponent))
+class RUNNER_API UAttributeMovementBindingComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UAttributeMovementBindingComponent();
+
+	virtual void InitializeComponent() override;
+	virtual void UninitializeComponent() override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	// 기준값 변경 (다음 틱에 반영)
+	UFUNCTION(BlueprintCallable, Category = "Movement")
+	void SetBaseValue(EMovementBindingTarget Target, float Value);
+
+	UFUNCTION(BlueprintCallable, Category = "Movement")
+	float GetBaseValue(EMovementBindingTarget Target) const;
+
+	// 대기 중인 변경 즉시 적용
+	UFUNCTION(BlueprintCallable, Category = "Movement")
+	void FlushPendingBindings();
+
+public:
+	// 최대 32개
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement")
+	TArray<FAttributeMovementBinding> Bindings;
+
+private:
+	void OnAttributeChanged(const FOnAttributeChangeData& Data);
+
+	void MarkDirty(uint32 Mask);
+
+	static float ReadMovementValue(const UCharacterMovementComponent* Movement, EMovementBindingTarget Target);
+
+	static void WriteMovementValue(UCharacterMovementComponent* Movement, EMovementBindingTarget Target, float Value);
+
+private:
+	UPROPERTY(Transient)
+	TObjectPtr<UAbilitySystemComponent> AbilitySystemComponent;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UCharacterMovementComponent> MovementComponent;
+
+	// 바인딩별 기준값 (초기화 시 CharacterMovement 값)
+	TArray<float> BaseValues;
+
+	// 어트리뷰트별 변경 델리게이트 핸들
+	TMap<FGameplayAttribute, FDelegateHandle> ChangeHandles;
+
+	// 적용 대기 중인 바인딩 비트
+	uint32 DirtyMask = 0;
+
+	// 어트리뷰트 값을 받은 바인딩 비트 (0이 아닌 값을 읽었거나 변경 알림을 받음)
+	uint32 InitializedMask = 0;
+};
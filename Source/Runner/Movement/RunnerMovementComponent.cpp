@@ -0,0 +1,206 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RunnerMovementComponent.h"
+
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/Character.h"
+
+void URunnerMovementComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (bStartLaneRunning && CharacterOwner)
+	{
+		StartLaneRunning(CharacterOwner->GetActorLocation(), CharacterOwner->GetActorForwardVector());
+	}
+}
+
+bool URunnerMovementComponent::CanAttemptJump() const
+{
+	if (IsLaneRunning())
+	{
+		return IsJumpAllowed() && !bLaneAirborne;
+	}
+	return Super::CanAttemptJump();
+}
+
+bool URunnerMovementComponent::DoJump(bool bReplayingMoves)
+{
+	if (!IsLaneRunning())
+	{
+		return Super::DoJump(bReplayingMoves);
+	}
+
+	if (!CharacterOwner || !CharacterOwner->CanJump())
+	{
+		return false;
+	}
+
+	// 모드 전환 없이 수직 속도만 설정 (궤적은 StepLaneRunning에서 해석적으로 계산)
+	bLaneAirborne = true;
+	LaneVerticalSpeed = JumpZVelocity;
+	return true;
+}
+
+void URunnerMovementComponent::StartLaneRunning(FVector Origin, FVector Direction)
+{
+	TrackDirection = Direction.GetSafeNormal2D();
+	if (TrackDirection.IsNearlyZero())
+	{
+		TrackDirection = FVector::ForwardVector;
+	}
+	TrackRight = FVector::CrossProduct(FVector::UpVector, TrackDirection);
+
+	// 가운데 레인을 Origin에 맞춤
+	TrackOrigin = Origin;
+	CurrentLane = LaneCount / 2;
+	bLaneAirborne = false;
+	LaneVerticalSpeed = 0.f;
+	FixedStepAccumulator = 0.f;
+
+	SetMovementMode(MOVE_Custom, static_cast<uint8>(ERunnerCustomMovementMode::LaneRunning));
+}
+
+void URunnerMovementComponent::StopLaneRunning()
+{
+	if (IsLaneRunning())
+	{
+		SetMovementMode(MOVE_Walking);
+	}
+}
+
+bool URunnerMovementComponent::IsLaneRunning() const
+{
+	return MovementMode == MOVE_Custom && CustomMovementMode == static_cast<uint8>(ERunnerCustomMovementMode::LaneRunning);
+}
+
+void URunnerMovementComponent::ChangeLane(int32 Delta)
+{
+	CurrentLane = FMath::Clamp(CurrentLane + Delta, 0, LaneCount - 1);
+}
+
+void URunnerMovementComponent::PhysCustom(float DeltaTime, int32 Iterations)
+{
+	if (!IsLaneRunning())
+	{
+		Super::PhysCustom(DeltaTime, Iterations);
+		return;
+	}
+
+	if (DeltaTime < MIN_TICK_TIME || !UpdatedComponent)
+	{
+		return;
+	}
+
+	const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+	float SimulatedTime = DeltaTime;
+
+	if (bUseFixedStep)
+	{
+		const float StepTime = 1.f / FixedStepRate;
+		FixedStepAccumulator += DeltaTime;
+
+		int32 Steps = 0;
+		while (FixedStepAccumulator >= StepTime && Steps < MaxFixedSteps)
+		{
+			StepLaneRunning(StepTime);
+			FixedStepAccumulator -= StepTime;
+			++Steps;
+		}
+
+		// MaxFixedSteps를 넘은 시간은 버리지 않고 다음 프레임으로 이월 (총 시뮬레이션 시간 = 실제 시간)
+		SimulatedTime = Steps * StepTime;
+	}
+	else
+	{
+		StepLaneRunning(DeltaTime);
+	}
+
+	// 애니메이션용 속도
+	if (SimulatedTime > 0.f)
+	{
+		Velocity = (UpdatedComponent->GetComponentLocation() - OldLocation) / SimulatedTime;
+		Velocity.Z = bLaneAirborne ? LaneVerticalSpeed : 0.f;
+	}
+}
+
+void URunnerMovementComponent::StepLaneRunning(float StepTime)
+{
+	const FVector Location = UpdatedComponent->GetComponentLocation();
+
+	// 좌우: 목표 레인으로 일정 속도 이동
+	const float Lateral = FVector::DotProduct(Location - TrackOrigin, TrackRight);
+	const float NewLateral = FMath::FInterpConstantTo(Lateral, GetLaneOffset(CurrentLane), StepTime, LaneChangeSpeed);
+
+	FVector Delta = TrackDirection * (MaxWalkSpeed * StepTime) + TrackRight * (NewLateral - Lateral);
+
+	// 수직: 등가속도 해석해 (스텝 크기와 무관한 같은 포물선)
+	if (bLaneAirborne)
+	{
+		const float GravityZ = GetGravityZ();
+		Delta.Z += LaneVerticalSpeed * StepTime + 0.5f * GravityZ * StepTime * StepTime;
+		LaneVerticalSpeed += GravityZ * StepTime;
+	}
+
+	FHitResult Hit;
+	SafeMoveUpdatedComponent(Delta, TrackDirection.Rotation(), true, Hit);
+	if (Hit.IsValidBlockingHit())
+	{
+		HandleImpact(Hit, StepTime, Delta);
+		SlideAlongSurface(Delta, 1.f - Hit.Time, Hit.Normal, Hit, true);
+	}
+
+	// 상승 중에는 바닥 판정 생략
+	if (!bLaneAirborne || LaneVerticalSpeed <= 0.f)
+	{
+		UpdateLaneFloor();
+	}
+}
+
+void URunnerMovementComponent::UpdateLaneFloor()
+{
+	const float HalfHeight = CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	const FVector Start = UpdatedComponent->GetComponentLocation();
+
+	// 착지 중에는 거의 닿았을 때만, 지상에서는 FloorProbeDistance 안이면 바닥 유지
+	const float ProbeDistance = bLaneAirborne ? 2.f : FloorProbeDistance;
+	const FVector End = Start - FVector(0.f, 0.f, HalfHeight + ProbeDistance);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(RunnerLaneFloor), false, CharacterOwner);
+	FHitResult FloorHit;
+	const bool bHasFloor = GetWorld()->LineTraceSingleByChannel(FloorHit, Start, End, UpdatedComponent->GetCollisionObjectType(), QueryParams)
+		&& IsWalkable(FloorHit);
+
+	if (!bHasFloor)
+	{
+		// 발밑이 비면 낙하 시작
+		if (!bLaneAirborne)
+		{
+			bLaneAirborne = true;
+			LaneVerticalSpeed = 0.f;
+		}
+		return;
+	}
+
+	const float SnapDelta = FloorHit.ImpactPoint.Z + HalfHeight - Start.Z;
+	if (FMath::Abs(SnapDelta) > UE_KINDA_SMALL_NUMBER)
+	{
+		FHitResult SnapHit;
+		SafeMoveUpdatedComponent(FVector(0.f, 0.f, SnapDelta), UpdatedComponent->GetComponentQuat(), true, SnapHit);
+	}
+
+	if (bLaneAirborne)
+	{
+		bLaneAirborne = false;
+		LaneVerticalSpeed = 0.f;
+		// 모드 전환이 없어 OnMovementModeChanged가 점프 상태를 초기화하지 않으므로 직접 초기화
+		CharacterOwner->ResetJumpState();
+		CharacterOwner->Landed(FloorHit);
+	}
+}
+
+float URunnerMovementComponent::GetLaneOffset(int32 Lane) const
+{
+	return (Lane - (LaneCount - 1) * 0.5f) * LaneWidth;
+}
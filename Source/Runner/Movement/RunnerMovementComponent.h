@@ -0,0 +1,109 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "RunnerMovementComponent.generated.h"
+
+UENUM(BlueprintType)
+enum class ERunnerCustomMovementMode : uint8
+{
+	None,
+	// 레인 달리기 (자동 전진 + 레인 이동 + 단순 점프)
+	LaneRunning
+};
+
+/**
+ * 레인 러너 전용 이동 컴포넌트.
+ * LaneRunning 모드에서는 트랙 방향 자동 전진, 레인 보간, 해석적 점프 궤적만 계산하고
+ * 바닥 판정은 라인 트레이스 1회로 대신함. 고정 스텝으로 돌리면 프레임레이트와 무관하게 같은 결과.
+ */
+UCLASS()
+class RUNNER_API URunnerMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	virtual void BeginPlay() override;
+	virtual bool CanAttemptJump() const override;
+	virtual bool DoJump(bool bReplayingMoves) override;
+
+	// 레인 달리기 시작 (Origin = 가운데 레인 기준점, Direction = 진행 방향)
+	UFUNCTION(BlueprintCallable, Category = "Runner Movement")
+	void StartLaneRunning(FVector Origin, FVector Direction);
+
+	// 일반 걷기로 복귀
+	UFUNCTION(BlueprintCallable, Category = "Runner Movement")
+	void StopLaneRunning();
+
+	UFUNCTION(BlueprintCallable, Category = "Runner Movement")
+	bool IsLaneRunning() const;
+
+	// 레인 이동 (Delta = -1 왼쪽, +1 오른쪽)
+	UFUNCTION(BlueprintCallable, Category = "Runner Movement")
+	void ChangeLane(int32 Delta);
+
+	UFUNCTION(BlueprintCallable, Category = "Runner Movement")
+	int32 GetCurrentLane() const { return CurrentLane; }
+
+	UFUNCTION(BlueprintCallable, Category = "Runner Movement")
+	bool IsLaneAirborne() const { return bLaneAirborne; }
+
+public:
+	// BeginPlay에서 바로 레인 달리기 시작 (액터 위치/방향 기준, 레인 러너 BP에서만 켬)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runner Movement")
+	bool bStartLaneRunning = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runner Movement", meta = (ClampMin = "1"))
+	int32 LaneCount = 3;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runner Movement", meta = (ClampMin = "0.0"))
+	float LaneWidth = 300.f;
+
+	// 레인 사이 좌우 이동 속도
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runner Movement", meta = (ClampMin = "0.0"))
+	float LaneChangeSpeed = 1500.f;
+
+	// 바닥 유지 판정 거리 (캡슐 바닥 아래)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runner Movement", meta = (ClampMin = "0.0"))
+	float FloorProbeDistance = 50.f;
+
+	// 고정 스텝 시뮬레이션 (봇 런 재현용)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runner Movement")
+	bool bUseFixedStep = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runner Movement", meta = (ClampMin = "10.0", EditCondition = "bUseFixedStep"))
+	float FixedStepRate = 120.f;
+
+	// 한 프레임 최대 스텝 수 (남은 시간은 다음 프레임에 이어서 처리)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Runner Movement", meta = (ClampMin = "1", EditCondition = "bUseFixedStep"))
+	int32 MaxFixedSteps = 8;
+
+protected:
+	virtual void PhysCustom(float DeltaTime, int32 Iterations) override;
+
+private:
+	void StepLaneRunning(float StepTime);
+
+	// 바닥 트레이스 후 착지/이탈 처리
+	void UpdateLaneFloor();
+
+	float GetLaneOffset(int32 Lane) const;
+
+private:
+	FVector TrackOrigin = FVector::ZeroVector;
+
+	FVector TrackDirection = FVector::ForwardVector;
+
+	FVector TrackRight = FVector::RightVector;
+
+	int32 CurrentLane = 0;
+
+	bool bLaneAirborne = false;
+
+	float LaneVerticalSpeed = 0.f;
+
+	// 고정 스텝 남은 시간
+	float FixedStepAccumulator = 0.f;
+};
@@ -0,0 +1,216 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ProjectileSubsystem.h"
+
+#include "Runner/Interfaces/CombatInterface.h"
+
+void UProjectileSubsystem::Deinitialize()
+{
+	Positions.Reset();
+	Velocities.Reset();
+	RemainingLifetimes.Reset();
+	Radii.Reset();
+	GravityZs.Reset();
+	RemainingPierces.Reset();
+	TargetObjectTypes.Reset();
+	WorldObjectTypes.Reset();
+	DamageSpecs.Reset();
+	Instigators.Reset();
+	HitActors.Reset();
+	Visuals.Reset();
+	VisualPools.Reset();
+
+	Super::Deinitialize();
+}
+
+void UProjectileSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const int32 NumProjectiles = Positions.Num();
+	if (NumProjectiles == 0)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+
+	// 1. 수명/속도 갱신 (연속 배열 순회)
+	for (int32 i = 0; i < NumProjectiles; ++i)
+	{
+		RemainingLifetimes[i] -= DeltaTime;
+		Velocities[i].Z += GravityZs[i] * DeltaTime;
+	}
+
+	// 2. 이동 구간 스윕 + 히트 처리 (뒤에서부터 제거)
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(RunnerProjectileSweep), false);
+
+	for (int32 i = NumProjectiles - 1; i >= 0; --i)
+	{
+		if (RemainingLifetimes[i] <= 0.f)
+		{
+			RemoveProjectileAt(i);
+			continue;
+		}
+
+		const FVector Start = Positions[i];
+		const FVector End = Start + Velocities[i] * DeltaTime;
+		const FCollisionShape Shape = FCollisionShape::MakeSphere(Radii[i]);
+
+		QueryParams.ClearIgnoredSourceObjects();
+		if (AActor* Instigator = Instigators[i].Get())
+		{
+			QueryParams.AddIgnoredActor(Instigator);
+		}
+
+		// 지형은 첫 블로킹 히트 하나만 (벽 너머 대상은 맞지 않도록 대상 스윕을 거기서 끊음)
+		FHitResult WorldHit;
+		const bool bHitWorld = World->SweepSingleByObjectType(WorldHit, Start, End, FQuat::Identity, FCollisionObjectQueryParams(WorldObjectTypes[i]), Shape, QueryParams);
+		const FVector TargetEnd = bHitWorld ? WorldHit.Location : End;
+
+		// 대상은 오브젝트 타입 쿼리로 구간 안의 전부를 받음 (채널 스윕은 첫 블로킹 대상에서 멈춰 관통이 누락됨)
+		HitResults.Reset();
+		World->SweepMultiByObjectType(HitResults, Start, TargetEnd, FQuat::Identity, FCollisionObjectQueryParams(TargetObjectTypes[i]), Shape, QueryParams);
+		HitResults.Sort([](const FHitResult& A, const FHitResult& B) { return A.Time < B.Time; });
+
+		bool bDestroyed = false;
+		for (const FHitResult& Hit : HitResults)
+		{
+			AActor* HitActor = Hit.GetActor();
+			if (!IsValid(HitActor) || HitActors[i].Contains(HitActor) || !HitActor->Implements<UCombatInterface>())
+			{
+				continue;
+			}
+
+			HitActors[i].Add(HitActor);
+			if (DamageSpecs[i].IsValid())
+			{
+				ICombatInterface::Execute_ApplyDamageEffect(HitActor, DamageSpecs[i]);
+			}
+
+			if (RemainingPierces[i]-- <= 0)
+			{
+				bDestroyed = true;
+				break;
+			}
+		}
+
+		if (bDestroyed || bHitWorld)
+		{
+			RemoveProjectileAt(i);
+			continue;
+		}
+
+		Positions[i] = End;
+		if (AActor* Visual = Visuals[i])
+		{
+			Visual->SetActorLocationAndRotation(End, Velocities[i].Rotation());
+		}
+	}
+}
+
+TStatId UProjectileSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UProjectileSubsystem, STATGROUP_Tickables);
+}
+
+void UProjectileSubsystem::FireProjectile(TSubclassOf<AActor> VisualClass, FVector Location, FVector Velocity, const FRunnerProjectileParams& Params)
+{
+	Positions.Add(Location);
+	Velocities.Add(Velocity);
+	RemainingLifetimes.Add(Params.Lifetime);
+	Radii.Add(Params.Radius);
+	GravityZs.Add(Params.GravityZ);
+	RemainingPierces.Add(Params.MaxPierceCount);
+	TargetObjectTypes.Add(Params.TargetObjectType);
+	WorldObjectTypes.Add(Params.WorldObjectType);
+	DamageSpecs.Add(Params.DamageSpec);
+	Instigators.Add(Params.Instigator);
+	HitActors.AddDefaulted();
+	Visuals.Add(AcquireVisual(VisualClass, Location, Velocity.Rotation()));
+}
+
+void UProjectileSubsystem::PrewarmPool(TSubclassOf<AActor> VisualClass, int32 Count)
+{
+	if (!VisualClass)
+	{
+		return;
+	}
+
+	const int32 NumToSpawn = Count - VisualPools.FindOrAdd(VisualClass).FreeActors.Num();
+	for (int32 i = 0; i < NumToSpawn; ++i)
+	{
+		ReleaseVisual(SpawnVisual(VisualClass, FVector::ZeroVector, FRotator::ZeroRotator));
+	}
+}
+
+AActor* UProjectileSubsystem::AcquireVisual(TSubclassOf<AActor> VisualClass, const FVector& Location, const FRotator& Rotation)
+{
+	if (!VisualClass)
+	{
+		return nullptr;
+	}
+
+	FRunnerProjectileVisualPool& Pool = VisualPools.FindOrAdd(VisualClass);
+	while (Pool.FreeActors.Num() > 0)
+	{
+		AActor* Visual = Pool.FreeActors.Pop(EAllowShrinking::No);
+		if (IsValid(Visual))
+		{
+			Visual->SetActorLocationAndRotation(Location, Rotation);
+			Visual->SetActorHiddenInGame(false);
+			return Visual;
+		}
+	}
+
+	return SpawnVisual(VisualClass, Location, Rotation);
+}
+
+AActor* UProjectileSubsystem::SpawnVisual(TSubclassOf<AActor> VisualClass, const FVector& Location, const FRotator& Rotation)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AActor* Visual = GetWorld()->SpawnActor<AActor>(VisualClass, Location, Rotation, SpawnParams);
+	if (Visual)
+	{
+		// 이동/충돌은 서브시스템이 담당하므로 액터 자체는 표시만
+		Visual->SetActorTickEnabled(false);
+		Visual->SetActorEnableCollision(false);
+		for (UActorComponent* Component : Visual->GetComponents())
+		{
+			Component->SetComponentTickEnabled(false);
+		}
+	}
+	return Visual;
+}
+
+void UProjectileSubsystem::ReleaseVisual(AActor* Visual)
+{
+	if (!IsValid(Visual))
+	{
+		return;
+	}
+
+	Visual->SetActorHiddenInGame(true);
+	VisualPools.FindOrAdd(Visual->GetClass()).FreeActors.Add(Visual);
+}
+
+void UProjectileSubsystem::RemoveProjectileAt(int32 Index)
+{
+	ReleaseVisual(Visuals[Index]);
+
+	Positions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	RemainingLifetimes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Radii.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	GravityZs.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	RemainingPierces.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	TargetObjectTypes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	WorldObjectTypes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	DamageSpecs.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Instigators.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	HitActors.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Visuals.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
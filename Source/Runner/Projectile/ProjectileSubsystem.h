@@ -0,0 +1,127 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffectTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ProjectileSubsystem.generated.h"
+
+USTRUCT(BlueprintType)
+struct RUNNER_API FRunnerProjectileParams
+{
+	GENERATED_BODY()
+
+	// 충돌 반경
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Radius = 10.f;
+
+	// 최대 생존 시간
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Lifetime = 3.f;
+
+	// 중력 가속도 (Z, 음수면 아래로)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float GravityZ = 0.f;
+
+	// 관통 가능한 대상 수 (0이면 첫 히트에서 소멸)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int32 MaxPierceCount = 0;
+
+	// 전투 대상 오브젝트 타입 (오버랩으로 찾으므로 앞의 대상이 뒤의 대상을 가리지 않음)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TEnumAsByte<ECollisionChannel> TargetObjectType = ECC_Pawn;
+
+	// 막히면 소멸하는 지형 오브젝트 타입 (따로 한 번만 스윕)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TEnumAsByte<ECollisionChannel> WorldObjectType = ECC_WorldStatic;
+
+	// 히트 시 ICombatInterface::ApplyDamageEffect로 전달할 스펙
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FGameplayEffectSpecHandle DamageSpec;
+
+	// 발사자 (충돌 무시)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TObjectPtr<AActor> Instigator;
+};
+
+USTRUCT()
+struct FRunnerProjectileVisualPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AActor>> FreeActors;
+};
+
+/**
+ * 화살 등 단순 투사체를 한 번에 이동/충돌 처리하는 서브시스템.
+ * 위치/속도를 연속 배열로 관리하고 틱 한 번에 전부 적분 + 스윕하며, 표시용 액터는 클래스별 풀에서 재사용.
+ */
+UCLASS()
+class RUNNER_API UProjectileSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 투사체 발사 (VisualClass는 틱/충돌 없이 위치만 따라가는 표시용 액터)
+	UFUNCTION(BlueprintCallable, Category = "Projectile")
+	void FireProjectile(TSubclassOf<AActor> VisualClass, FVector Location, FVector Velocity, const FRunnerProjectileParams& Params);
+
+	// 활성 투사체 수
+	UFUNCTION(BlueprintCallable, Category = "Projectile")
+	int32 GetActiveProjectileCount() const { return Positions.Num(); }
+
+	// 표시용 액터 미리 생성
+	UFUNCTION(BlueprintCallable, Category = "Projectile")
+	void PrewarmPool(TSubclassOf<AActor> VisualClass, int32 Count);
+
+private:
+	AActor* AcquireVisual(TSubclassOf<AActor> VisualClass, const FVector& Location, const FRotator& Rotation);
+
+	AActor* SpawnVisual(TSubclassOf<AActor> VisualClass, const FVector& Location, const FRotator& Rotation);
+
+	void ReleaseVisual(AActor* Visual);
+
+	void RemoveProjectileAt(int32 Index);
+
+private:
+	/*~ 투사체 (SoA, 같은 인덱스 = 같은 투사체) ~*/
+
+	TArray<FVector> Positions;
+
+	TArray<FVector> Velocities;
+
+	TArray<float> RemainingLifetimes;
+
+	TArray<float> Radii;
+
+	TArray<float> GravityZs;
+
+	TArray<int32> RemainingPierces;
+
+	TArray<TEnumAsByte<ECollisionChannel>> TargetObjectTypes;
+
+	TArray<TEnumAsByte<ECollisionChannel>> WorldObjectTypes;
+
+	TArray<FGameplayEffectSpecHandle> DamageSpecs;
+
+	TArray<TWeakObjectPtr<AActor>> Instigators;
+
+	TArray<TArray<TWeakObjectPtr<AActor>, TInlineAllocator<4>>> HitActors;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AActor>> Visuals;
+
+	/*~ 풀 ~*/
+
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, FRunnerProjectileVisualPool> VisualPools;
+
+	// 스윕 결과 버퍼 (재사용)
+	TArray<FHitResult> HitResults;
+};
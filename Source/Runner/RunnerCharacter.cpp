@@ -13,13 +13,16 @@
 #include "EnhancedInputSubsystems.h"
 #include "InputActionValue.h"
 #include "AbilitySystem/RunnerAttributeSet.h"
+#include "Movement/AttributeMovementBindingComponent.h"
+#include "Movement/RunnerMovementComponent.h"
 
 DEFINE_LOG_CATEGORY(LogTemplateCharacter);
 
 //////////////////////////////////////////////////////////////////////////
 // ARunnerCharacter
 
-ARunnerCharacter::ARunnerCharacter()
+ARunnerCharacter::ARunnerCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<URunnerMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
 	// Set size for collision capsule
 	GetCapsuleComponent()->InitCapsuleSize(42.f, 96.0f);
@@ -55,19 +58,16 @@ ARunnerCharacter::ARunnerCharacter()
 
 	AbilitySystemComponent = CreateDefaultSubobject<UAbilitySystemComponent>(TEXT("AbilitySystemComponent"));
 	RunnerAttributeSet = CreateDefaultSubobject<URunnerAttributeSet>(TEXT("RunnerAttributeSet"));
+	MovementBinding = CreateDefaultSubobject<UAttributeMovementBindingComponent>(TEXT("MovementBinding"));
 }
 
 void ARunnerCharacter::BeginPlay()
 {
 	// Call the base class  
 	Super::BeginPlay();
-	
-	AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(URunnerAttributeSet::GetMoveSpeedMultiplierAttribute()).AddLambda(
-	[this](const FOnAttributeChangeData& Data)
-	{
-		float NewMovementSpeed = Data.NewValue * BaseMovementSpeed; 
-		GetCharacterMovement()->MaxWalkSpeed = NewMovementSpeed;
-	});
+
+	// BP에서 바꾼 기본 이동 속도를 바인딩 기준값으로 사용 (배율 어트리뷰트가 곱해짐)
+	MovementBinding->SetBaseValue(EMovementBindingTarget::MaxWalkSpeed, BaseMovementSpeed);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -107,7 +107,15 @@ void ARunnerCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCom
 void ARunnerCharacter::Move(const FInputActionValue& Value)
 {
 	// input is a Vector2D
+	const FVector2D PrevMovementVector = MovementVector;
 	MovementVector = Value.Get<FVector2D>();
+
+	// 좌우 입력이 새로 눌렸을 때만 레인 이동
+	URunnerMovementComponent* RunnerMovement = GetRunnerMovement();
+	if (RunnerMovement && RunnerMovement->IsLaneRunning() && FMath::Abs(PrevMovementVector.X) < 0.5f && FMath::Abs(MovementVector.X) >= 0.5f)
+	{
+		RunnerMovement->ChangeLane(MovementVector.X > 0.f ? 1 : -1);
+	}
 }
 
 void ARunnerCharacter::StopMoving()
@@ -115,6 +123,11 @@ void ARunnerCharacter::StopMoving()
 	MovementVector = FVector2D::ZeroVector;
 }
 
+URunnerMovementComponent* ARunnerCharacter::GetRunnerMovement() const
+{
+	return Cast<URunnerMovementComponent>(GetCharacterMovement());
+}
+
 void ARunnerCharacter::Look(const FInputActionValue& Value)
 {
 	// input is a Vector2D
@@ -9,6 +9,8 @@
 #include "RunnerCharacter.generated.h"
 
 class URunnerAttributeSet;
+class UAttributeMovementBindingComponent;
+class URunnerMovementComponent;
 class UAbilitySystemComponent;
 class USpringArmComponent;
 class UCameraComponent;
@@ -48,7 +50,7 @@ class ARunnerCharacter : public ACharacter, public IAbilitySystemInterface
 	UInputAction* LookAction;
 
 public:
-	ARunnerCharacter();
+	ARunnerCharacter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override {return AbilitySystemComponent;}
 	
@@ -74,10 +76,17 @@ public:
 	FORCEINLINE class USpringArmComponent* GetCameraBoom() const { return CameraBoom; }
 	/** Returns FollowCamera subobject **/
 	FORCEINLINE class UCameraComponent* GetFollowCamera() const { return FollowCamera; }
+	/** Returns lane running movement component **/
+	URunnerMovementComponent* GetRunnerMovement() const;
 	
 protected:
+	// 기본 이동 속도 (BeginPlay에서 MovementBinding의 MaxWalkSpeed 기준값으로 적용)
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly)
 	float BaseMovementSpeed = 600.f;
+
+	// 이동 배율 어트리뷰트 -> CharacterMovement (프레임당 1회 적용)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	UAttributeMovementBindingComponent* MovementBinding;
 	
 	UPROPERTY(BlueprintReadOnly)
 	FVector2D MovementVector;
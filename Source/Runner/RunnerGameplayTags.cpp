@@ -2,3 +2,8 @@
 
 UE_DEFINE_GAMEPLAY_TAG(TAG_Data_Critical,"Data.Critical");
 UE_DEFINE_GAMEPLAY_TAG(TAG_Data_AttackPower,"Data.AttackPower");
+UE_DEFINE_GAMEPLAY_TAG(TAG_Data_HitCount,"Data.HitCount");
+UE_DEFINE_GAMEPLAY_TAG(TAG_Data_CriticalCount,"Data.CriticalCount");
+UE_DEFINE_GAMEPLAY_TAG(TAG_Data_CriticalDamage,"Data.CriticalDamage");
+
+UE_DEFINE_GAMEPLAY_TAG(TAG_Damage_Type,"Damage.Type");
@@ -2,4 +2,9 @@
 #include "NativeGameplayTags.h"
 
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Data_Critical);
-UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Data_AttackPower);
\ No newline at end of file
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Data_AttackPower);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Data_HitCount);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Data_CriticalCount);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Data_CriticalDamage);
+
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Damage_Type);
\ No newline at end of file
@@ -0,0 +1,85 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "RunnerSettings.generated.h"
+
+class UDamageNumberWidget;
+
+/**
+ * Runner 게임 설정.
+ * Project Settings > Game > Runner 에서 접근.
+ */
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "Runner"))
+class RUNNER_API URunnerSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	virtual FName GetCategoryName() const override { return TEXT("Game"); }
+
+	static const URunnerSettings* Get() { return GetDefault<URunnerSettings>(); }
+
+public:
+	// 데미지 숫자 위젯 클래스
+	UPROPERTY(Config, EditAnywhere, Category = "Damage Number")
+	TSoftClassPtr<UDamageNumberWidget> DamageNumberWidgetClass;
+
+	// 미리 만들어 둘 위젯 수
+	UPROPERTY(Config, EditAnywhere, Category = "Damage Number", meta = (ClampMin = "0"))
+	int32 DamageNumberPoolSize = 32;
+
+	// 동시에 표시할 최대 숫자 수 (넘으면 가장 오래된 것을 재사용)
+	UPROPERTY(Config, EditAnywhere, Category = "Damage Number", meta = (ClampMin = "1"))
+	int32 MaxConcurrentDamageNumbers = 64;
+
+	// 표시 시간
+	UPROPERTY(Config, EditAnywhere, Category = "Damage Number", meta = (ClampMin = "0.1"))
+	float DamageNumberLifetime = 0.8f;
+
+	// 이 시간 안에 같은 대상이 다시 맞으면 기존 숫자에 합산
+	UPROPERTY(Config, EditAnywhere, Category = "Damage Number", meta = (ClampMin = "0.0"))
+	float DamageNumberMergeWindow = 0.15f;
+
+	// 초당 상승 높이
+	UPROPERTY(Config, EditAnywhere, Category = "Damage Number")
+	float DamageNumberRiseSpeed = 80.f;
+
+	// 대상 위치 기준 오프셋
+	UPROPERTY(Config, EditAnywhere, Category = "Damage Number")
+	FVector DamageNumberOffset = FVector(0.f, 0.f, 100.f);
+
+	// 이 거리보다 먼 적은 CharacterMovement 틱 생략
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy", meta = (ClampMin = "0.0"))
+	float EnemyMovementLODDistance = 4000.f;
+
+	// 틱당 LOD 거리 검사할 적 수
+	UPROPERTY(Config, EditAnywhere, Category = "Enemy", meta = (ClampMin = "1"))
+	int32 EnemyMovementLODUpdatesPerTick = 64;
+
+	// 타일 액터 클래스 (변형별)
+	UPROPERTY(Config, EditAnywhere, Category = "Tile Streaming")
+	TArray<TSoftClassPtr<AActor>> TileClasses;
+
+	// 타일 하나의 길이 (진행 방향)
+	UPROPERTY(Config, EditAnywhere, Category = "Tile Streaming", meta = (ClampMin = "1.0"))
+	float TileLength = 2000.f;
+
+	// 플레이어 앞쪽으로 미리 배치할 거리
+	UPROPERTY(Config, EditAnywhere, Category = "Tile Streaming", meta = (ClampMin = "0.0"))
+	float TileLookAheadDistance = 8000.f;
+
+	// 플레이어 뒤쪽으로 유지할 거리
+	UPROPERTY(Config, EditAnywhere, Category = "Tile Streaming", meta = (ClampMin = "0.0"))
+	float TileKeepBehindDistance = 2000.f;
+
+	// 미리 뽑아 비동기 로드해 둘 다음 타일 수
+	UPROPERTY(Config, EditAnywhere, Category = "Tile Streaming", meta = (ClampMin = "1"))
+	int32 TilePrefetchCount = 4;
+
+	// 메모리에 유지할 최대 타일 변형 수 (넘으면 쓰지 않는 변형 해제)
+	UPROPERTY(Config, EditAnywhere, Category = "Tile Streaming", meta = (ClampMin = "1"))
+	int32 MaxResidentTileVariants = 6;
+};
@@ -0,0 +1,26 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RunnerTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Runner/AbilitySystem/RunnerAttributeSet.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRunnerCriticalStreamRestartTest, "Runner.Damage.Critical.ReseedOnRunRestart", RUNNER_TEST_FLAGS)
+
+bool FRunnerCriticalStreamRestartTest::RunTest(const FString& Parameters)
+{
+	URunnerAttributeSet* AttributeSet = NewObject<URunnerAttributeSet>();
+
+	const float FirstRoll = AttributeSet->GetCriticalStream(5, 1).FRand();
+	const float SecondRoll = AttributeSet->GetCriticalStream(5, 1).FRand();
+	TestNotEqual(TEXT("Same run continues the sequence"), SecondRoll, FirstRoll);
+
+	// 같은 시드로 다시 시작한 런은 첫 판정부터 같은 수열
+	TestEqual(TEXT("Restarted run replays the sequence"), AttributeSet->GetCriticalStream(5, 2).FRand(), FirstRoll);
+	TestEqual(TEXT("Restarted run second roll"), AttributeSet->GetCriticalStream(5, 2).FRand(), SecondRoll);
+	return true;
+}
+
+#endif
@@ -0,0 +1,70 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RunnerTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystemComponent.h"
+#include "RunnerTestCombatActor.h"
+#include "Runner/AbilitySystem/DamageBatchSubsystem.h"
+#include "Runner/AbilitySystem/RunnerAttributeSet.h"
+
+using namespace RunnerTests;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRunnerDamageBatchMergeTest, "Runner.Damage.Batch.MergesExecutionOnlyHits", RUNNER_TEST_FLAGS)
+
+bool FRunnerDamageBatchMergeTest::RunTest(const FString& Parameters)
+{
+	FTestWorld TestWorld;
+	UDamageBatchSubsystem* DamageBatch = TestWorld.GetWorld()->GetSubsystem<UDamageBatchSubsystem>();
+	ARunnerTestCombatActor* Source = TestWorld.SpawnCombatant();
+	ARunnerTestCombatActor* Target = TestWorld.SpawnCombatant(1000.f);
+
+	int32 Applications = 0;
+	Target->AbilitySystemComponent->OnGameplayEffectAppliedDelegateToSelf.AddLambda([&Applications](UAbilitySystemComponent*, const FGameplayEffectSpec&, FActiveGameplayEffectHandle)
+	{
+		++Applications;
+	});
+
+	UGameplayEffect* Effect = TestWorld.MakeDamageEffect();
+	TestTrue(TEXT("Execution-only effect is batchable"), DamageBatch->IsBatchableEffect(Effect));
+
+	for (int32 Hit = 0; Hit < 3; ++Hit)
+	{
+		DamageBatch->QueueDamage(Target->AbilitySystemComponent, TestWorld.MakeDamageSpec(Source->AbilitySystemComponent, Effect, 10.f));
+	}
+	TestEqual(TEXT("Nothing applied before flush"), Applications, 0);
+
+	DamageBatch->FlushPendingDamage();
+	TestEqual(TEXT("One execution per target"), Applications, 1);
+	TestEqual(TEXT("Damage of every hit"), Target->GetHealth(), 970.f);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRunnerDamageBatchFallbackTest, "Runner.Damage.Batch.AppliesOtherEffectsPerHit", RUNNER_TEST_FLAGS)
+
+bool FRunnerDamageBatchFallbackTest::RunTest(const FString& Parameters)
+{
+	FTestWorld TestWorld;
+	UDamageBatchSubsystem* DamageBatch = TestWorld.GetWorld()->GetSubsystem<UDamageBatchSubsystem>();
+	ARunnerTestCombatActor* Source = TestWorld.SpawnCombatant();
+	ARunnerTestCombatActor* Target = TestWorld.SpawnCombatant(1000.f);
+
+	// 모디파이어가 있는 GE는 합치면 모디파이어가 한 번만 적용되므로 히트마다 적용
+	UGameplayEffect* Effect = TestWorld.MakeDamageEffect(true);
+	TestFalse(TEXT("Effect with modifier is not batchable"), DamageBatch->IsBatchableEffect(Effect));
+
+	const float AttackSpeedBefore = Target->AbilitySystemComponent->GetNumericAttribute(URunnerAttributeSet::GetAttackSpeedAttribute());
+	for (int32 Hit = 0; Hit < 3; ++Hit)
+	{
+		DamageBatch->QueueDamage(Target->AbilitySystemComponent, TestWorld.MakeDamageSpec(Source->AbilitySystemComponent, Effect, 10.f));
+	}
+	DamageBatch->FlushPendingDamage();
+
+	TestEqual(TEXT("Modifier per hit"), Target->AbilitySystemComponent->GetNumericAttribute(URunnerAttributeSet::GetAttackSpeedAttribute()), AttackSpeedBefore + 3.f);
+	TestEqual(TEXT("Damage per hit"), Target->GetHealth(), 970.f);
+	return true;
+}
+
+#endif
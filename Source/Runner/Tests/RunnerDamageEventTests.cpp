@@ -0,0 +1,70 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RunnerTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystemComponent.h"
+#include "RunnerTestCombatActor.h"
+#include "Runner/AbilitySystem/DamageBatchSubsystem.h"
+#include "Runner/AbilitySystem/RunnerAttributeSet.h"
+
+using namespace RunnerTests;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRunnerDamageEventAggregateTest, "Runner.Damage.Events.OnePerActorWithCriticalShare", RUNNER_TEST_FLAGS)
+
+bool FRunnerDamageEventAggregateTest::RunTest(const FString& Parameters)
+{
+	FTestWorld TestWorld;
+	UDamageBatchSubsystem* DamageBatch = TestWorld.GetWorld()->GetSubsystem<UDamageBatchSubsystem>();
+	ARunnerTestCombatActor* Target = TestWorld.SpawnCombatant();
+
+	DamageBatch->QueueDamageEvent(Target, 30.f, 20.f, 3, 1);
+	DamageBatch->QueueDamageEvent(Target, 10.f, 0.f, 1, 0);
+	TestEqual(TEXT("Nothing before dispatch"), Target->AppliedDamages.Num(), 0);
+
+	DamageBatch->DispatchDamageEvents();
+	if (TestEqual(TEXT("Normal and critical share"), Target->AppliedDamages.Num(), 2))
+	{
+		TestEqual(TEXT("Normal damage"), Target->AppliedDamages[0].Key, 20.f);
+		TestFalse(TEXT("Normal flag"), Target->AppliedDamages[0].Value);
+		TestEqual(TEXT("Critical damage"), Target->AppliedDamages[1].Key, 20.f);
+		TestTrue(TEXT("Critical flag"), Target->AppliedDamages[1].Value);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRunnerDamageEventCriticalPipelineTest, "Runner.Damage.Events.CriticalShareFromExecution", RUNNER_TEST_FLAGS)
+
+bool FRunnerDamageEventCriticalPipelineTest::RunTest(const FString& Parameters)
+{
+	FTestWorld TestWorld;
+	UDamageBatchSubsystem* DamageBatch = TestWorld.GetWorld()->GetSubsystem<UDamageBatchSubsystem>();
+	ARunnerTestCombatActor* NormalSource = TestWorld.SpawnCombatant();
+	ARunnerTestCombatActor* CriticalSource = TestWorld.SpawnCombatant();
+	ARunnerTestCombatActor* Target = TestWorld.SpawnCombatant(1000.f);
+
+	CriticalSource->AbilitySystemComponent->SetNumericAttributeBase(URunnerAttributeSet::GetCriticalChanceAttribute(), 2.f);
+	CriticalSource->AbilitySystemComponent->SetNumericAttributeBase(URunnerAttributeSet::GetCriticalMultiplierAttribute(), 2.f);
+
+	// 소스가 다르므로 배치는 두 개, 알림은 프레임 끝에 액터당 한 번
+	UGameplayEffect* Effect = TestWorld.MakeDamageEffect();
+	DamageBatch->QueueDamage(Target->AbilitySystemComponent, TestWorld.MakeDamageSpec(NormalSource->AbilitySystemComponent, Effect, 10.f));
+	DamageBatch->QueueDamage(Target->AbilitySystemComponent, TestWorld.MakeDamageSpec(CriticalSource->AbilitySystemComponent, Effect, 10.f));
+	DamageBatch->QueueDamage(Target->AbilitySystemComponent, TestWorld.MakeDamageSpec(CriticalSource->AbilitySystemComponent, Effect, 10.f));
+	DamageBatch->FlushPendingDamage();
+	DamageBatch->DispatchDamageEvents();
+
+	TestEqual(TEXT("Total damage"), Target->GetHealth(), 950.f);
+	if (TestEqual(TEXT("Normal and critical share"), Target->AppliedDamages.Num(), 2))
+	{
+		TestEqual(TEXT("Normal damage"), Target->AppliedDamages[0].Key, 10.f);
+		TestFalse(TEXT("Normal flag"), Target->AppliedDamages[0].Value);
+		TestEqual(TEXT("Critical damage"), Target->AppliedDamages[1].Key, 40.f);
+		TestTrue(TEXT("Critical flag"), Target->AppliedDamages[1].Value);
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,58 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RunnerTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystemComponent.h"
+#include "RunnerTestCombatActor.h"
+#include "Runner/AbilitySystem/DamageMitigationProfile.h"
+#include "Runner/AbilitySystem/RunnerAttributeSet.h"
+
+using namespace RunnerTests;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRunnerMitigationDefaultArmorTest, "Runner.Damage.Mitigation.ArmorWithoutProfile", RUNNER_TEST_FLAGS)
+
+bool FRunnerMitigationDefaultArmorTest::RunTest(const FString& Parameters)
+{
+	FTestWorld TestWorld;
+	ARunnerTestCombatActor* Source = TestWorld.SpawnCombatant();
+	ARunnerTestCombatActor* Target = TestWorld.SpawnCombatant(1000.f);
+	Target->AbilitySystemComponent->SetNumericAttributeBase(URunnerAttributeSet::GetArmorAttribute(), 100.f);
+
+	// 프로필 없이도 기본 ArmorConstant(100)로 방어력 적용: 100 * (1 - 100 / 200)
+	const FGameplayEffectSpecHandle Spec = TestWorld.MakeDamageSpec(Source->AbilitySystemComponent, TestWorld.MakeDamageEffect(), 100.f);
+	Target->AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*Spec.Data);
+
+	TestEqual(TEXT("Armor mitigates without a profile"), Target->GetHealth(), 950.f);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRunnerMitigationProfileTest, "Runner.Damage.Mitigation.ProfileOrder", RUNNER_TEST_FLAGS)
+
+bool FRunnerMitigationProfileTest::RunTest(const FString& Parameters)
+{
+	FTestWorld TestWorld;
+	ARunnerTestCombatActor* Source = TestWorld.SpawnCombatant();
+	ARunnerTestCombatActor* Target = TestWorld.SpawnCombatant(1000.f);
+	Target->AbilitySystemComponent->SetNumericAttributeBase(URunnerAttributeSet::GetArmorAttribute(), 100.f);
+	Target->AbilitySystemComponent->SetNumericAttributeBase(URunnerAttributeSet::GetFlatDamageReductionAttribute(), 10.f);
+
+	UDamageMitigationProfile* Profile = NewObject<UDamageMitigationProfile>(Target);
+	Profile->ArmorConstant = 300.f;
+	Profile->MinimumDamage = 5.f;
+	Target->MitigationProfile = Profile;
+
+	// 방어력 배율 → 고정 경감: 100 * (1 - 100 / 400) - 10
+	UGameplayEffect* Effect = TestWorld.MakeDamageEffect();
+	Target->AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*TestWorld.MakeDamageSpec(Source->AbilitySystemComponent, Effect, 100.f).Data);
+	TestEqual(TEXT("Armor then flat reduction"), Target->GetHealth(), 935.f);
+
+	// 경감 후 최소 데미지 보장
+	Target->AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*TestWorld.MakeDamageSpec(Source->AbilitySystemComponent, Effect, 1.f).Data);
+	TestEqual(TEXT("Minimum damage"), Target->GetHealth(), 930.f);
+	return true;
+}
+
+#endif
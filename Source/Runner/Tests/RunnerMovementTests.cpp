@@ -0,0 +1,61 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RunnerTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/World.h"
+#include "Runner/RunnerCharacter.h"
+#include "Runner/Movement/RunnerMovementComponent.h"
+
+using namespace RunnerTests;
+
+namespace
+{
+	// 같은 입력(1/4초 지점에서 오른쪽 레인)을 FrameRate 간격으로 1초 동안 재생한 뒤 위치
+	FVector SimulateLaneRun(UWorld* World, int32 FrameRate)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		ARunnerCharacter* Character = World->SpawnActor<ARunnerCharacter>(FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+		URunnerMovementComponent* Movement = Character->GetRunnerMovement();
+
+		// 스텝/프레임 간격이 2의 거듭제곱 분수라 누적 오차 없이 같은 스텝 순서가 됨
+		Movement->bUseFixedStep = true;
+		Movement->FixedStepRate = 128.f;
+		Movement->bRunPhysicsWithNoController = true;
+		Movement->StartLaneRunning(FVector::ZeroVector, FVector::ForwardVector);
+
+		const float DeltaTime = 1.f / FrameRate;
+		for (int32 Frame = 0; Frame < FrameRate; ++Frame)
+		{
+			if (Frame == FrameRate / 4)
+			{
+				Movement->ChangeLane(1);
+			}
+			Movement->TickComponent(DeltaTime, LEVELTICK_All, nullptr);
+		}
+
+		const FVector Location = Character->GetActorLocation();
+		Character->Destroy();
+		return Location;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRunnerMovementFixedStepTest, "Runner.Movement.FixedStepMatchesAcrossFrameRates", RUNNER_TEST_FLAGS)
+
+bool FRunnerMovementFixedStepTest::RunTest(const FString& Parameters)
+{
+	FTestWorld TestWorld;
+
+	const FVector At32 = SimulateLaneRun(TestWorld.GetWorld(), 32);
+	const FVector At64 = SimulateLaneRun(TestWorld.GetWorld(), 64);
+
+	TestTrue(TEXT("Moved forward"), At32.X > 0.f);
+	TestTrue(TEXT("Changed lane"), At32.Y > 0.f);
+	TestTrue(FString::Printf(TEXT("Same position (%s vs %s)"), *At32.ToString(), *At64.ToString()), At32.Equals(At64, 0.f));
+	return true;
+}
+
+#endif
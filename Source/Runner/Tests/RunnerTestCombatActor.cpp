@@ -0,0 +1,38 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RunnerTestCombatActor.h"
+
+#include "AbilitySystemComponent.h"
+#include "Runner/AbilitySystem/RunnerAttributeSet.h"
+
+ARunnerTestCombatActor::ARunnerTestCombatActor()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	AbilitySystemComponent = CreateDefaultSubobject<UAbilitySystemComponent>(TEXT("AbilitySystemComponent"));
+	AttributeSet = CreateDefaultSubobject<URunnerAttributeSet>(TEXT("AttributeSet"));
+}
+
+void ARunnerTestCombatActor::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	AbilitySystemComponent->InitAbilityActorInfo(this, this);
+}
+
+void ARunnerTestCombatActor::InitHealth(float InHealth)
+{
+	AbilitySystemComponent->SetNumericAttributeBase(URunnerAttributeSet::GetMaxHealthAttribute(), InHealth);
+	AbilitySystemComponent->SetNumericAttributeBase(URunnerAttributeSet::GetHealthAttribute(), InHealth);
+}
+
+float ARunnerTestCombatActor::GetHealth() const
+{
+	return AbilitySystemComponent->GetNumericAttribute(URunnerAttributeSet::GetHealthAttribute());
+}
+
+void ARunnerTestCombatActor::OnDamageApplied_Implementation(float DamageAmount, bool bIsCriticalHit)
+{
+	AppliedDamages.Emplace(DamageAmount, bIsCriticalHit);
+}
@@ -0,0 +1,53 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilitySystemInterface.h"
+#include "GameFramework/Actor.h"
+#include "Runner/Interfaces/CombatInterface.h"
+#include "RunnerTestCombatActor.generated.h"
+
+class UAbilitySystemComponent;
+class URunnerAttributeSet;
+class UDamageMitigationProfile;
+
+/**
+ * 자동화 테스트용 전투 액터.
+ * ASC와 URunnerAttributeSet만 가지고, 받은 데미지 알림을 기록함.
+ */
+UCLASS(NotBlueprintable, NotPlaceable, Transient, HideDropdown)
+class RUNNER_API ARunnerTestCombatActor : public AActor, public IAbilitySystemInterface, public ICombatInterface
+{
+	GENERATED_BODY()
+
+public:
+	ARunnerTestCombatActor();
+
+	virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override { return AbilitySystemComponent; }
+	virtual const UDamageMitigationProfile* GetDamageMitigationProfile() const override { return MitigationProfile; }
+
+	virtual void PostInitializeComponents() override;
+
+	// 체력 초기화 (MaxHealth 포함)
+	void InitHealth(float InHealth);
+
+	float GetHealth() const;
+
+public:
+	UPROPERTY()
+	UAbilitySystemComponent* AbilitySystemComponent;
+
+	UPROPERTY()
+	URunnerAttributeSet* AttributeSet;
+
+	UPROPERTY()
+	UDamageMitigationProfile* MitigationProfile = nullptr;
+
+	// OnDamageApplied로 받은 (데미지, 크리티컬) 기록
+	TArray<TPair<float, bool>> AppliedDamages;
+
+protected:
+	virtual void OnDamageApplied_Implementation(float DamageAmount, bool bIsCriticalHit) override;
+	virtual bool IsDead_Implementation() override { return false; }
+};
@@ -0,0 +1,76 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RunnerTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystemComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameplayEffect.h"
+#include "RunnerTestCombatActor.h"
+#include "Runner/RunnerGameplayTags.h"
+#include "Runner/AbilitySystem/DamageExecutionCalculation.h"
+#include "Runner/AbilitySystem/RunnerAttributeSet.h"
+
+namespace RunnerTests
+{
+	FTestWorld::FTestWorld()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, MakeUniqueObjectName(GetTransientPackage(), UWorld::StaticClass(), TEXT("RunnerTestWorld")));
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+	}
+
+	FTestWorld::~FTestWorld()
+	{
+		for (UGameplayEffect* Effect : Effects)
+		{
+			Effect->RemoveFromRoot();
+		}
+
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	ARunnerTestCombatActor* FTestWorld::SpawnCombatant(float Health)
+	{
+		ARunnerTestCombatActor* Actor = World->SpawnActor<ARunnerTestCombatActor>();
+		Actor->InitHealth(Health);
+		return Actor;
+	}
+
+	UGameplayEffect* FTestWorld::MakeDamageEffect(bool bWithModifier)
+	{
+		UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage(), NAME_None, RF_Transient);
+		Effect->AddToRoot();
+		Effect->DurationPolicy = EGameplayEffectDurationType::Instant;
+
+		FGameplayEffectExecutionDefinition& Execution = Effect->Executions.AddDefaulted_GetRef();
+		Execution.CalculationClass = UDamageExecutionCalculation::StaticClass();
+
+		if (bWithModifier)
+		{
+			FGameplayModifierInfo& Modifier = Effect->Modifiers.AddDefaulted_GetRef();
+			Modifier.Attribute = URunnerAttributeSet::GetAttackSpeedAttribute();
+			Modifier.ModifierOp = EGameplayModOp::Additive;
+			Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(1.f));
+		}
+
+		Effects.Add(Effect);
+		return Effect;
+	}
+
+	FGameplayEffectSpecHandle FTestWorld::MakeDamageSpec(UAbilitySystemComponent* SourceASC, UGameplayEffect* Effect, float AttackPower) const
+	{
+		FGameplayEffectSpecHandle SpecHandle(new FGameplayEffectSpec(Effect, SourceASC->MakeEffectContext(), 1.f));
+		SpecHandle.Data->SetSetByCallerMagnitude(TAG_Data_AttackPower, AttackPower);
+		return SpecHandle;
+	}
+}
+
+#endif
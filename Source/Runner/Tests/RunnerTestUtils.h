@@ -0,0 +1,49 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "GameplayEffectTypes.h"
+#include "Misc/AutomationTest.h"
+
+class UWorld;
+class UGameplayEffect;
+class UAbilitySystemComponent;
+class ARunnerTestCombatActor;
+
+// 자동화 테스트 공통 플래그
+#define RUNNER_TEST_FLAGS (EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+namespace RunnerTests
+{
+	/**
+	 * 테스트 전용 게임 월드.
+	 * 월드 서브시스템(데미지 배치 등)이 초기화된 상태로 만들고 소멸 시 정리.
+	 */
+	class FTestWorld
+	{
+	public:
+		FTestWorld();
+		~FTestWorld();
+
+		UWorld* GetWorld() const { return World; }
+
+		// 체력을 채운 전투 액터 스폰
+		ARunnerTestCombatActor* SpawnCombatant(float Health = 1000.f);
+
+		// UDamageExecutionCalculation만 실행하는 Instant GE (bWithModifier면 배치 불가 GE)
+		UGameplayEffect* MakeDamageEffect(bool bWithModifier = false);
+
+		// 공격력 SetByCaller가 들어간 데미지 스펙
+		FGameplayEffectSpecHandle MakeDamageSpec(UAbilitySystemComponent* SourceASC, UGameplayEffect* Effect, float AttackPower) const;
+
+	private:
+		UWorld* World = nullptr;
+		TArray<UGameplayEffect*> Effects;
+	};
+}
+
+#endif
@@ -0,0 +1,285 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "TileStreamingSubsystem.h"
+
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Runner/RunnerSettings.h"
+
+void UTileStreamingSubsystem::Deinitialize()
+{
+	StopStreaming();
+
+	for (TPair<TObjectPtr<UClass>, FRunnerTilePool>& Pair : TilePools)
+	{
+		for (AActor* Tile : Pair.Value.FreeTiles)
+		{
+			if (IsValid(Tile))
+			{
+				Tile->Destroy();
+			}
+		}
+	}
+	TilePools.Reset();
+	VariantHandles.Reset();
+
+	Super::Deinitialize();
+}
+
+void UTileStreamingSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!bStreaming)
+	{
+		return;
+	}
+
+	const APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	if (!PlayerPawn)
+	{
+		return;
+	}
+
+	const URunnerSettings* Settings = URunnerSettings::Get();
+	const float Progress = FVector::DotProduct(PlayerPawn->GetActorLocation() - StreamOrigin, StreamDirection);
+
+	// 뒤로 충분히 지나간 타일 회수
+	while (RingCount > 0 && (RingTileIndices[RingHead] + 1) * Settings->TileLength < Progress - Settings->TileKeepBehindDistance)
+	{
+		RecycleOldestTile();
+	}
+
+	// 앞쪽 배치 (뽑힌 변형이 로드될 때까지 미루고, 플레이어가 마지막 타일에 닿을 때만 동기 로드)
+	while (NextTileIndex * Settings->TileLength < Progress + Settings->TileLookAheadDistance)
+	{
+		const bool bNeededNow = NextTileIndex * Settings->TileLength < Progress + Settings->TileLength;
+		if (!PlaceNextTile(bNeededNow))
+		{
+			break;
+		}
+	}
+}
+
+TStatId UTileStreamingSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTileStreamingSubsystem, STATGROUP_Tickables);
+}
+
+void UTileStreamingSubsystem::StartStreaming(FVector Origin, FVector Direction, int32 Seed)
+{
+	StopStreaming();
+
+	const URunnerSettings* Settings = URunnerSettings::Get();
+	if (Settings->TileClasses.Num() == 0)
+	{
+		return;
+	}
+
+	bStreaming = true;
+	StreamOrigin = Origin;
+	StreamDirection = Direction.GetSafeNormal();
+	if (StreamDirection.IsNearlyZero())
+	{
+		StreamDirection = FVector::ForwardVector;
+	}
+	VariantStream.Initialize(Seed);
+
+	// 앞쪽 + 뒤쪽 거리를 덮는 만큼 링 용량 확보
+	const int32 Capacity = FMath::CeilToInt((Settings->TileLookAheadDistance + Settings->TileKeepBehindDistance) / Settings->TileLength) + 2;
+	RingTiles.SetNum(Capacity);
+	RingTileIndices.SetNum(Capacity);
+	RingHead = 0;
+	RingCount = 0;
+	NextTileIndex = 0;
+
+	RefillUpcomingVariants();
+
+	// 시작 구간은 바로 필요하므로 동기 로드
+	for (int32 Variant : UpcomingVariants)
+	{
+		Settings->TileClasses[Variant].LoadSynchronous();
+	}
+
+	const int32 InitialTiles = FMath::CeilToInt(Settings->TileLookAheadDistance / Settings->TileLength);
+	for (int32 i = 0; i < InitialTiles; ++i)
+	{
+		PlaceNextTile(true);
+	}
+}
+
+void UTileStreamingSubsystem::StopStreaming()
+{
+	while (RingCount > 0)
+	{
+		RecycleOldestTile();
+	}
+
+	bStreaming = false;
+	UpcomingVariants.Reset();
+}
+
+bool UTileStreamingSubsystem::PlaceNextTile(bool bBlockUntilLoaded)
+{
+	const URunnerSettings* Settings = URunnerSettings::Get();
+
+	RefillUpcomingVariants();
+	UClass* TileClass = ResolveTileClass(UpcomingVariants[0], bBlockUntilLoaded);
+	if (!TileClass && !bBlockUntilLoaded)
+	{
+		return false;
+	}
+
+	UpcomingVariants.RemoveAt(0, 1, EAllowShrinking::No);
+	RefillUpcomingVariants();
+
+	// 링이 가득 차면 (설정 변경 등) 가장 오래된 타일부터 재사용
+	if (RingCount == RingTiles.Num())
+	{
+		RecycleOldestTile();
+	}
+
+	AActor* Tile = TileClass ? AcquireTile(TileClass) : nullptr;
+
+	const int32 TileIndex = NextTileIndex++;
+	const int32 Slot = (RingHead + RingCount) % RingTiles.Num();
+	RingTiles[Slot] = Tile;
+	RingTileIndices[Slot] = TileIndex;
+	++RingCount;
+
+	if (Tile)
+	{
+		Tile->SetActorLocationAndRotation(StreamOrigin + StreamDirection * (TileIndex * Settings->TileLength), StreamDirection.Rotation());
+		Tile->SetActorHiddenInGame(false);
+		Tile->SetActorEnableCollision(true);
+		OnTilePlaced.Broadcast(Tile, TileIndex);
+	}
+
+	EnforceResidentBudget();
+	return true;
+}
+
+void UTileStreamingSubsystem::RecycleOldestTile()
+{
+	ReleaseTile(RingTiles[RingHead]);
+	RingTiles[RingHead] = nullptr;
+	RingHead = (RingHead + 1) % RingTiles.Num();
+	--RingCount;
+}
+
+void UTileStreamingSubsystem::RefillUpcomingVariants()
+{
+	const URunnerSettings* Settings = URunnerSettings::Get();
+	const int32 NumVariants = Settings->TileClasses.Num();
+	if (NumVariants == 0)
+	{
+		return;
+	}
+
+	while (UpcomingVariants.Num() < Settings->TilePrefetchCount)
+	{
+		UpcomingVariants.Add(VariantStream.RandHelper(NumVariants));
+	}
+
+	// 곧 필요한 변형은 미리 비동기 로드
+	FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+	for (int32 Variant : UpcomingVariants)
+	{
+		if (!VariantHandles.Contains(Variant))
+		{
+			VariantHandles.Add(Variant, StreamableManager.RequestAsyncLoad(Settings->TileClasses[Variant].ToSoftObjectPath()));
+		}
+	}
+}
+
+void UTileStreamingSubsystem::EnforceResidentBudget()
+{
+	const URunnerSettings* Settings = URunnerSettings::Get();
+	if (VariantHandles.Num() <= Settings->MaxResidentTileVariants)
+	{
+		return;
+	}
+
+	TSet<UClass*> ClassesInUse;
+	for (int32 i = 0; i < RingCount; ++i)
+	{
+		if (AActor* Tile = RingTiles[(RingHead + i) % RingTiles.Num()])
+		{
+			ClassesInUse.Add(Tile->GetClass());
+		}
+	}
+
+	for (auto It = VariantHandles.CreateIterator(); It && VariantHandles.Num() > Settings->MaxResidentTileVariants; ++It)
+	{
+		const int32 Variant = It.Key();
+		UClass* TileClass = Settings->TileClasses[Variant].Get();
+		if (UpcomingVariants.Contains(Variant) || (TileClass && ClassesInUse.Contains(TileClass)))
+		{
+			continue;
+		}
+
+		// 풀에 남은 인스턴스도 정리해야 클래스가 해제됨
+		if (TileClass)
+		{
+			if (FRunnerTilePool* Pool = TilePools.Find(TileClass))
+			{
+				for (AActor* Tile : Pool->FreeTiles)
+				{
+					if (IsValid(Tile))
+					{
+						Tile->Destroy();
+					}
+				}
+			}
+			TilePools.Remove(TileClass);
+		}
+
+		if (It.Value().IsValid())
+		{
+			It.Value()->ReleaseHandle();
+		}
+		It.RemoveCurrent();
+	}
+}
+
+UClass* UTileStreamingSubsystem::ResolveTileClass(int32 Variant, bool bBlockUntilLoaded) const
+{
+	// 다른 변형으로 대체하면 같은 시드에서 다른 트랙이 나오므로 뽑힌 변형만 사용
+	const TSoftClassPtr<AActor>& TileClass = URunnerSettings::Get()->TileClasses[Variant];
+	if (UClass* LoadedClass = TileClass.Get())
+	{
+		return LoadedClass;
+	}
+	return bBlockUntilLoaded ? TileClass.LoadSynchronous() : nullptr;
+}
+
+AActor* UTileStreamingSubsystem::AcquireTile(UClass* TileClass)
+{
+	FRunnerTilePool& Pool = TilePools.FindOrAdd(TileClass);
+	while (Pool.FreeTiles.Num() > 0)
+	{
+		AActor* Tile = Pool.FreeTiles.Pop(EAllowShrinking::No);
+		if (IsValid(Tile))
+		{
+			return Tile;
+		}
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	return GetWorld()->SpawnActor<AActor>(TileClass, FTransform::Identity, SpawnParams);
+}
+
+void UTileStreamingSubsystem::ReleaseTile(AActor* Tile)
+{
+	if (!IsValid(Tile))
+	{
+		return;
+	}
+
+	Tile->SetActorHiddenInGame(true);
+	Tile->SetActorEnableCollision(false);
+	TilePools.FindOrAdd(Tile->GetClass()).FreeTiles.Add(Tile);
+}
@@ -0,0 +1,104 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TileStreamingSubsystem.generated.h"
+
+struct FStreamableHandle;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FRunnerTilePlacedSignature, AActor*, Tile, int32, TileIndex);
+
+USTRUCT()
+struct FRunnerTilePool
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AActor>> FreeTiles;
+};
+
+/**
+ * 무한 트랙 타일 스트리밍.
+ * 배치된 타일을 링 버퍼로 관리해 뒤로 지나간 타일을 앞쪽에 재배치하고, 다음 타일 변형은 미리 뽑아 비동기로 로드.
+ */
+UCLASS()
+class RUNNER_API UTileStreamingSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 스트리밍 시작 (Origin에서 Direction 방향으로 타일 배치)
+	UFUNCTION(BlueprintCallable, Category = "Tile")
+	void StartStreaming(FVector Origin, FVector Direction, int32 Seed = 0);
+
+	// 스트리밍 중지 (배치된 타일은 풀로 회수)
+	UFUNCTION(BlueprintCallable, Category = "Tile")
+	void StopStreaming();
+
+	UFUNCTION(BlueprintCallable, Category = "Tile")
+	bool IsStreaming() const { return bStreaming; }
+
+public:
+	// 타일 배치/재배치 이벤트 (장애물 재배치 등)
+	UPROPERTY(BlueprintAssignable, Category = "Tile")
+	FRunnerTilePlacedSignature OnTilePlaced;
+
+private:
+	// 다음 타일 배치 (뽑힌 변형이 아직 로드 중이면 bBlockUntilLoaded가 아닌 한 미루고 false)
+	bool PlaceNextTile(bool bBlockUntilLoaded);
+
+	void RecycleOldestTile();
+
+	// 다음 변형 큐 보충 + 비동기 로드 요청
+	void RefillUpcomingVariants();
+
+	// 메모리 예산 초과 시 쓰지 않는 변형 해제
+	void EnforceResidentBudget();
+
+	// 변형 클래스 (로드 전이면 bBlockUntilLoaded일 때만 동기 로드, 아니면 nullptr)
+	UClass* ResolveTileClass(int32 Variant, bool bBlockUntilLoaded) const;
+
+	AActor* AcquireTile(UClass* TileClass);
+
+	void ReleaseTile(AActor* Tile);
+
+private:
+	bool bStreaming = false;
+
+	FVector StreamOrigin = FVector::ZeroVector;
+
+	FVector StreamDirection = FVector::ForwardVector;
+
+	FRandomStream VariantStream;
+
+	/*~ 링 버퍼 (RingHead부터 RingCount개, 오래된 순) ~*/
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AActor>> RingTiles;
+
+	TArray<int32> RingTileIndices;
+
+	int32 RingHead = 0;
+
+	int32 RingCount = 0;
+
+	// 다음에 배치할 타일 번호
+	int32 NextTileIndex = 0;
+
+	/*~ 변형 ~*/
+
+	// 다음에 쓸 변형 (앞에서부터 사용)
+	TArray<int32> UpcomingVariants;
+
+	// 로드된 변형 핸들
+	TMap<int32, TSharedPtr<FStreamableHandle>> VariantHandles;
+
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, FRunnerTilePool> TilePools;
+};
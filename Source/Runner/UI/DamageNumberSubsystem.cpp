@@ -0,0 +1,191 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "DamageNumberSubsystem.h"
+
+#include "DamageNumberWidget.h"
+#include "Kismet/GameplayStatics.h"
+#include "Runner/RunnerSettings.h"
+
+void UDamageNumberSubsystem::Deinitialize()
+{
+	for (UDamageNumberWidget* Widget : AllWidgets)
+	{
+		if (IsValid(Widget))
+		{
+			Widget->RemoveFromParent();
+		}
+	}
+	AllWidgets.Reset();
+	FreeWidgets.Reset();
+	ActiveNumbers.Reset();
+
+	Super::Deinitialize();
+}
+
+void UDamageNumberSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (ActiveNumbers.Num() == 0)
+	{
+		return;
+	}
+
+	const URunnerSettings* Settings = URunnerSettings::Get();
+	APlayerController* PlayerController = UGameplayStatics::GetPlayerController(GetWorld(), 0);
+
+	for (int32 i = ActiveNumbers.Num() - 1; i >= 0; --i)
+	{
+		FActiveDamageNumber& Number = ActiveNumbers[i];
+		Number.Age += DeltaTime;
+
+		if (Number.Age >= Settings->DamageNumberLifetime || !IsValid(Number.Widget) || !PlayerController)
+		{
+			ReleaseAt(i);
+			continue;
+		}
+
+		const FVector Location = Number.WorldLocation + FVector(0.f, 0.f, Settings->DamageNumberRiseSpeed * Number.Age);
+
+		FVector2D ScreenPosition;
+		if (UGameplayStatics::ProjectWorldToScreen(PlayerController, Location, ScreenPosition))
+		{
+			Number.Widget->SetPositionInViewport(ScreenPosition);
+			Number.Widget->SetVisibility(ESlateVisibility::HitTestInvisible);
+		}
+		else
+		{
+			Number.Widget->SetVisibility(ESlateVisibility::Collapsed);
+		}
+	}
+}
+
+TStatId UDamageNumberSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDamageNumberSubsystem, STATGROUP_Tickables);
+}
+
+void UDamageNumberSubsystem::ShowDamageNumber(AActor* Target, float Damage, bool bIsCritical)
+{
+	if (!IsValid(Target) || !EnsurePool())
+	{
+		return;
+	}
+
+	const URunnerSettings* Settings = URunnerSettings::Get();
+	const FVector WorldLocation = Target->GetActorLocation() + Settings->DamageNumberOffset;
+
+	// 같은 대상의 연속 히트는 기존 숫자에 합산 (크리티컬은 일반 히트와 따로)
+	for (FActiveDamageNumber& Number : ActiveNumbers)
+	{
+		if (Number.Target == Target && Number.bIsCritical == bIsCritical && Number.Age <= Settings->DamageNumberMergeWindow)
+		{
+			Number.Damage += Damage;
+			Number.WorldLocation = WorldLocation;
+			Number.Age = 0.f;
+			Number.Widget->ShowDamage(Number.Damage, Number.bIsCritical, true);
+			return;
+		}
+	}
+
+	// 동시 표시 수 초과 시 가장 오래된 숫자 재사용
+	if (ActiveNumbers.Num() >= Settings->MaxConcurrentDamageNumbers)
+	{
+		int32 OldestIndex = 0;
+		for (int32 i = 1; i < ActiveNumbers.Num(); ++i)
+		{
+			if (ActiveNumbers[i].Age > ActiveNumbers[OldestIndex].Age)
+			{
+				OldestIndex = i;
+			}
+		}
+		ReleaseAt(OldestIndex);
+	}
+
+	UDamageNumberWidget* Widget = AcquireWidget();
+	if (!Widget)
+	{
+		return;
+	}
+
+	FActiveDamageNumber& Number = ActiveNumbers.AddDefaulted_GetRef();
+	Number.Target = Target;
+	Number.Widget = Widget;
+	Number.WorldLocation = WorldLocation;
+	Number.Damage = Damage;
+	Number.bIsCritical = bIsCritical;
+
+	Widget->SetVisibility(ESlateVisibility::Collapsed);
+	Widget->ShowDamage(Damage, bIsCritical, false);
+}
+
+bool UDamageNumberSubsystem::EnsurePool()
+{
+	if (bPoolCreated)
+	{
+		return WidgetClass != nullptr;
+	}
+
+	APlayerController* PlayerController = UGameplayStatics::GetPlayerController(GetWorld(), 0);
+	if (!PlayerController || !PlayerController->IsLocalController())
+	{
+		return false;
+	}
+
+	bPoolCreated = true;
+
+	const URunnerSettings* Settings = URunnerSettings::Get();
+	WidgetClass = Settings->DamageNumberWidgetClass.LoadSynchronous();
+	if (!WidgetClass)
+	{
+		return false;
+	}
+
+	const int32 PoolSize = FMath::Min(Settings->DamageNumberPoolSize, Settings->MaxConcurrentDamageNumbers);
+	for (int32 i = 0; i < PoolSize; ++i)
+	{
+		if (UDamageNumberWidget* Widget = CreateWidget<UDamageNumberWidget>(PlayerController, WidgetClass))
+		{
+			Widget->AddToViewport();
+			Widget->SetVisibility(ESlateVisibility::Collapsed);
+			AllWidgets.Add(Widget);
+			FreeWidgets.Add(Widget);
+		}
+	}
+	return true;
+}
+
+UDamageNumberWidget* UDamageNumberSubsystem::AcquireWidget()
+{
+	if (FreeWidgets.Num() > 0)
+	{
+		return FreeWidgets.Pop(EAllowShrinking::No);
+	}
+
+	// 풀이 모자라면 최대 동시 표시 수까지만 추가 생성
+	APlayerController* PlayerController = UGameplayStatics::GetPlayerController(GetWorld(), 0);
+	if (!PlayerController || AllWidgets.Num() >= URunnerSettings::Get()->MaxConcurrentDamageNumbers)
+	{
+		return nullptr;
+	}
+
+	UDamageNumberWidget* Widget = CreateWidget<UDamageNumberWidget>(PlayerController, WidgetClass);
+	if (Widget)
+	{
+		Widget->AddToViewport();
+		AllWidgets.Add(Widget);
+	}
+	return Widget;
+}
+
+void UDamageNumberSubsystem::ReleaseAt(int32 ActiveIndex)
+{
+	UDamageNumberWidget* Widget = ActiveNumbers[ActiveIndex].Widget;
+	if (IsValid(Widget))
+	{
+		Widget->SetVisibility(ESlateVisibility::Collapsed);
+		FreeWidgets.Add(Widget);
+	}
+	ActiveNumbers.RemoveAtSwap(ActiveIndex, 1, EAllowShrinking::No);
+}
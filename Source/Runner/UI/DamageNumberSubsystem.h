@@ -0,0 +1,63 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DamageNumberSubsystem.generated.h"
+
+class UDamageNumberWidget;
+
+/**
+ * 데미지 숫자 표시 관리.
+ * 미리 만든 위젯 풀에서 꺼내 쓰고, 짧은 시간 안의 연속 히트는 같은 숫자에 합산하며, 동시 표시 수를 제한함.
+ */
+UCLASS()
+class RUNNER_API UDamageNumberSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 대상 위에 데미지 숫자 표시
+	void ShowDamageNumber(AActor* Target, float Damage, bool bIsCritical);
+
+private:
+	struct FActiveDamageNumber
+	{
+		TWeakObjectPtr<AActor> Target;
+
+		UDamageNumberWidget* Widget = nullptr;
+
+		FVector WorldLocation = FVector::ZeroVector;
+
+		float Damage = 0.f;
+
+		bool bIsCritical = false;
+
+		float Age = 0.f;
+	};
+
+	// 위젯 풀 생성 (로컬 플레이어가 있을 때 한 번)
+	bool EnsurePool();
+
+	UDamageNumberWidget* AcquireWidget();
+
+	void ReleaseAt(int32 ActiveIndex);
+
+private:
+	// 생성한 모든 위젯 (GC 유지)
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UDamageNumberWidget>> AllWidgets;
+
+	TArray<UDamageNumberWidget*> FreeWidgets;
+
+	TArray<FActiveDamageNumber> ActiveNumbers;
+
+	TSubclassOf<UDamageNumberWidget> WidgetClass;
+
+	bool bPoolCreated = false;
+};
@@ -0,0 +1,15 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "DamageNumberWidget.h"
+
+#include "Components/TextBlock.h"
+
+void UDamageNumberWidget::ShowDamage(float Damage, bool bIsCritical, bool bMerged)
+{
+	if (DamageText)
+	{
+		DamageText->SetText(FText::AsNumber(FMath::RoundToInt(Damage)));
+	}
+	OnDamageShown(Damage, bIsCritical, bMerged);
+}
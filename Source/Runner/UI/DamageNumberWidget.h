@@ -0,0 +1,31 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "DamageNumberWidget.generated.h"
+
+class UTextBlock;
+
+/**
+ * 풀링되는 데미지 숫자 위젯 베이스.
+ * DamageText가 바인딩되어 있으면 네이티브로 텍스트를 갱신하고, 연출은 블루프린트 이벤트로 처리.
+ */
+UCLASS(Abstract)
+class RUNNER_API UDamageNumberWidget : public UUserWidget
+{
+	GENERATED_BODY()
+
+public:
+	// 표시 (bMerged = 기존 숫자에 합산)
+	void ShowDamage(float Damage, bool bIsCritical, bool bMerged);
+
+protected:
+	UFUNCTION(BlueprintImplementableEvent)
+	void OnDamageShown(float Damage, bool bIsCritical, bool bMerged);
+
+protected:
+	UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional))
+	TObjectPtr<UTextBlock> DamageText;
+};